@@ -1234,6 +1234,28 @@
  */
 //#define DEBUG_LEVELING_FEATURE
 
+/**
+ * Probe ABL and UBL grids in the order with the least travel, starting
+ * from the point nearest the probe, instead of a fixed zig-zag. Points the
+ * probe can't reach are left out of the path. Between neighboring points
+ * the probe only rises by PROBE_PATH_NEAR_CLEARANCE.
+ */
+//#define OPTIMIZE_PROBE_PATH
+#if ENABLED(OPTIMIZE_PROBE_PATH)
+  #define PROBE_PATH_NEAR_CLEARANCE 2 // (mm) Z Clearance between neighboring grid points
+#endif
+
+/**
+ * Keep the probe moving between ABL and UBL grid points. The raise, the
+ * travel and a fast descent to just above the bed expected from the probed
+ * neighbors are queued together. Only the probing stroke waits, for the
+ * trigger. A trigger during the fast descent repeats the stroke.
+ */
+//#define PIPELINED_PROBING
+#if ENABLED(PIPELINED_PROBING)
+  #define PIPELINED_PROBING_MARGIN 1.5 // (mm) Stop the fast descent this far above the expected bed
+#endif
+
 #if ANY(MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
   // Gradually reduce leveling correction until a set height is reached,
   // at which point movement will be level to the machine's XY plane.
@@ -1318,6 +1340,10 @@
 
   //#define MESH_G28_REST_ORIGIN // After homing all axes ('G28' or 'G28 XYZ') rest Z at Z_MIN_POS
 
+  // Interpolate the mesh with smooth bicubic patches instead of bilinear planes.
+  // Uses 16 floats per mesh cell instead of 4 and costs more CPU per segment.
+  //#define MBL_BICUBIC_INTERPOLATION
+
 #endif // BED_LEVELING
 
 /**
@@ -1461,6 +1487,12 @@
 #define EEPROM_BOOT_SILENT    // Keep M503 quiet and only give errors during first load
 #if ENABLED(EEPROM_SETTINGS)
   //#define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
+  //#define EEPROM_JOURNAL    // Save only changed settings, as a log that moves through the pages of flash. (LINUX only for now)
+  #if ENABLED(EEPROM_JOURNAL)
+    #define EEPROM_JOURNAL_SIZE      2048 // (bytes) Settings storage, a multiple of 16
+    #define EEPROM_JOURNAL_PAGES        8 // Pages the log moves through
+    #define EEPROM_JOURNAL_PAGE_SIZE 2048 // (bytes) Size of one erasable page
+  #endif
 #endif
 
 //
@@ -334,6 +334,26 @@
 #define TEMP_SENSOR_AD8495_OFFSET 0.0
 #define TEMP_SENSOR_AD8495_GAIN   1.0
 
+/**
+ * Background ADC Filtering
+ * Sample the temperature ADC channels continuously in the background and filter
+ * each channel in the HAL with glitch rejection, a median and an IIR low-pass
+ * stage. Marlin's 16x oversampling is skipped, so temperatures update every ~10ms
+ * instead of ~164ms and the temperature ISR only fetches the filtered values.
+ *
+ * NOTE: Implemented for AVR and the LINUX simulator. AVR converts one channel on
+ *       each Timer0 overflow (~977Hz) in turn, so ADC_FILTER_SAMPLE_RATE only
+ *       applies to the simulator. M43 analog readings disturb the AVR scan.
+ */
+//#define ADC_BACKGROUND_FILTER
+#if ENABLED(ADC_BACKGROUND_FILTER)
+  #define ADC_FILTER_SAMPLE_RATE  2000  // (Hz) Background sampling rate of each channel
+  #define ADC_FILTER_MEDIAN_SIZE     5  // Odd number of samples (1-15) in the median stage
+  #define ADC_FILTER_LOWPASS_K       2  // IIR strength (0-8). Higher values are smoother but slower to settle.
+  #define ADC_FILTER_GLITCH_LIMIT   64  // (raw) Drop samples further than this from the median. 0 to disable.
+  #define ADC_FILTER_GLITCH_COUNT    3  // Accept a real step change after this many dropped samples in a row
+#endif
+
 /**
  * Controller Fan
  * To cool down the stepper drivers and MOSFETs.
@@ -608,6 +628,21 @@
 //#define QUICK_HOME                     // If homing includes X and Y, do a diagonal move initially
 //#define HOMING_BACKOFF_MM { 2, 2, 2 }  // (mm) Move away from the endstops after homing
 
+/**
+ * Endstop Trigger Timing
+ *
+ * Time each endstop and probe edge against the stepper timer and interpolate
+ * the trigger position between steps, instead of taking the step count when
+ * the move was stopped. Polled endstops are taken to have changed half way
+ * between polls, so ENDSTOP_INTERRUPTS_FEATURE gives the tighter result.
+ *
+ * With ENDSTOP_INTERRUPTS_FEATURE homing skips the slow bump, setting the axis
+ * from the trigger position. Polled endstops, axes that start on the switch and
+ * axes homed with separate endstops per stepper still bump. Probing reports the
+ * height where the probe triggered.
+ */
+//#define ENDSTOP_TRIGGER_TIMING
+
 // When G28 is called, this option will make Y home before X
 //#define HOME_Y_BEFORE_X
 
@@ -787,9 +822,14 @@
 // if unwanted behavior is observed on a user's machine when running at very slow speeds.
 #define MINIMUM_PLANNER_SPEED 0.05 // (mm/s)
 
+// Apply M220 feedrate changes to the moves already in the planner buffer,
+// instead of only to new moves. The buffered moves are replanned in place.
+//#define QUEUED_FEEDRATE_OVERRIDE
+
 //
 // Backlash Compensation
 // Adds extra movement to axes on direction-changes to account for backlash.
+// The extra steps are taken alongside the move that reverses the axis.
 //
 //#define BACKLASH_COMPENSATION
 #if ENABLED(BACKLASH_COMPENSATION)
@@ -798,9 +838,10 @@
   #define BACKLASH_DISTANCE_MM { 0, 0, 0 } // (mm)
   #define BACKLASH_CORRECTION    0.0       // 0.0 = no correction; 1.0 = full correction
 
-  // Set BACKLASH_SMOOTHING_MM to spread backlash correction over multiple segments
-  // to reduce print artifacts. (Enabling this is costly in memory and computation!)
-  //#define BACKLASH_SMOOTHING_MM 3 // (mm)
+  // Limit the speed and acceleration of the correction to reduce print artifacts.
+  // The rate squared may be up to 254 times the acceleration.
+  #define BACKLASH_CORRECTION_RATE    5000 // (steps/s)
+  #define BACKLASH_CORRECTION_ACCEL 500000 // (steps/s^2)
 
   // Add runtime configuration and tuning of backlash values (M425)
   //#define BACKLASH_GCODE
@@ -1090,6 +1131,30 @@
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
   #endif
 
+  /**
+   * Layer index for resuming a print from a layer.
+   *
+   * While a print runs from the top of a file, the position, line number and
+   * state (temperatures, fans, feedrate, E mode and position) at the start of
+   * each layer are written to LAYERS.IDX. Select the same file with M23, then
+   * 'M26 L<layer>' or 'M26 Z<height>' seeks to the layer, ready for M24.
+   */
+  //#define SD_LAYER_INDEX
+  #if ENABLED(SD_LAYER_INDEX)
+    #define SD_LAYER_INDEX_MIN_Z_CHANGE 0.05 // (mm) Minimum Z rise for a new layer
+  #endif
+
+  /**
+   * Analyze the selected file in the background, while the machine is idle.
+   * Estimates print time, filament, height and layers. Report with M36.
+   * ExtUI displays can show the results.
+   */
+  //#define SD_FILE_ANALYSIS
+  #if ENABLED(SD_FILE_ANALYSIS)
+    #define SD_FILE_ANALYSIS_CACHE      3 // Results kept for this many files
+    #define SD_FILE_ANALYSIS_SLICE_US 500 // (µs) Time given to the analysis in each idle()
+  #endif
+
   /**
    * Sort SD file listings in alphabetical order.
    *
@@ -1346,6 +1411,23 @@
   #endif
 #endif // HAS_DGUS_LCD
 
+//
+// Additional options for the Anycubic DWIN TFT
+//
+#if ENABLED(DWIN_TFT)
+  #define DWIN_TFT_RX_BUFFER_SIZE 128     // Serial ring buffer sizes. Powers of 2 from 2 to 1024.
+  #define DWIN_TFT_TX_BUFFER_SIZE 128     // Sizes above 128 need 16-bit indexes, which cost a little more.
+  //#define DWIN_TFT_PUSH_STATUS          // Send changed A0-A7 status lines without waiting for a poll
+  #if ENABLED(DWIN_TFT_PUSH_STATUS)
+    #define DWIN_TFT_PUSH_INTERVAL_MS 1000 // (ms) Minimum time between pushes
+  #endif
+  //#define DWIN_TFT_LOOP_STATS           // Report the time spent handling the TFT every 10 seconds
+  #if ENABLED(SDSUPPORT)
+    #define DWIN_TFT_FILE_CACHE_SIZE 4    // File list entries kept in RAM, 40 bytes each with two VFAT entries
+    #define DWIN_TFT_LIST_SLICE_US 500    // (µs) Time the file list may take per idle() call. One card read is always allowed.
+  #endif
+#endif
+
 //
 // Touch UI for the FTDI Embedded Video Engine (EVE)
 //
@@ -1481,6 +1563,10 @@
 //#define BABYSTEPPING
 #if ENABLED(BABYSTEPPING)
   //#define INTEGRATED_BABYSTEPPING         // EXPERIMENTAL integration of babystepping into the Stepper ISR
+  #if ENABLED(INTEGRATED_BABYSTEPPING)
+    #define BABYSTEP_MAX_RATE    1000       // (steps/s) Fastest babystepping, up to 8000. Large offsets ramp up to this rate.
+    #define BABYSTEP_ACCEL      50000       // (steps/s^2) Babystep ramp acceleration, at least MAX_RATE^2 / 254
+  #endif
   //#define BABYSTEP_WITHOUT_HOMING
   //#define BABYSTEP_XY                     // Also enable X/Y Babystepping. Not supported on DELTA!
   #define BABYSTEP_INVERT_Z false           // Change if Z babysteps should go the other way
@@ -1529,6 +1615,42 @@
 #if ENABLED(LIN_ADVANCE)
   #define LIN_ADVANCE_K 0    	// Unit: mm compression per 1mm/s extruder speed
   //#define LA_DEBUG          // If enabled, this will generate debug information output over USB.
+
+  /**
+   * Follow the step rate of the move with a smoothed advance, stepping E
+   * together with the other axes instead of from a separate E interrupt.
+   * Acceleration is not reduced, as the smoothing limits the E speed offset.
+   * Larger times give smoother E motion but a later pressure response.
+   */
+  //#define LIN_ADVANCE_SMOOTHING
+  #if ENABLED(LIN_ADVANCE_SMOOTHING)
+    #define LIN_ADVANCE_SMOOTH_TIME 40  // (ms) Time constant of the advance smoothing
+  #endif
+#endif
+
+// @section motion
+
+/**
+ * Input Shaping
+ *
+ * Split each X and Y step into a few impulses, delayed by fractions of the
+ * frame's ringing period, so the vibration each move excites cancels out.
+ * Measure the ringing frequency from a print (ringing spacing / speed) and
+ * set it with M593. The shaped axes lag the planner by up to one period.
+ *
+ * Types: 0:ZV  1:ZVD  2:MZV  3:EI (longer shapers tolerate a wrong frequency better)
+ * Cartesian machines only.
+ */
+//#define INPUT_SHAPING
+#if ENABLED(INPUT_SHAPING)
+  #define SHAPING_FREQ_X    40    // (Hz) Ringing frequency of the X axis. 0 to disable.
+  #define SHAPING_FREQ_Y    40    // (Hz) Ringing frequency of the Y axis. 0 to disable.
+  #define SHAPING_ZETA_X  0.10    // Damping ratio of the X axis
+  #define SHAPING_ZETA_Y  0.10    // Damping ratio of the Y axis
+  #define SHAPING_TYPE_X     1    // Shaper type of the X axis, as above
+  #define SHAPING_TYPE_Y     1    // Shaper type of the Y axis, as above
+  #define SHAPING_MIN_FREQ  20    // (Hz) Lowest frequency the step buffer can delay for
+  #define SHAPING_BUFFER_SIZE 40  // Step records per axis, 9 bytes each
 #endif
 
 // @section leveling
@@ -1642,6 +1764,7 @@
 #if ENABLED(ARC_SUPPORT)
   #define MM_PER_ARC_SEGMENT      1 // (mm) Length (or minimum length) of each arc segment
   //#define ARC_SEGMENTS_PER_R    1 // Max segment length, MM_PER = Min
+  //#define ARC_MAX_DEVIATION 0.005 // (mm) Segment length from the radius, for chords within this of the arc. Overrides MM_PER
   #define MIN_ARC_SEGMENTS       24 // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50 // Use feedrate to choose segment length (with MM_PER_ARC_SEGMENT as the minimum)
   #define N_ARC_CORRECTION       25 // Number of interpolated segments between corrections
@@ -1651,6 +1774,9 @@
 
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
 //#define BEZIER_CURVE_SUPPORT
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #define BEZIER_MAX_DEVIATION 0.05 // (mm) Largest distance of the segments from the curve
+#endif
 
 /**
  * G38 Probe Target
@@ -2899,7 +3025,8 @@
 /**
  * Cancel Objects
  *
- * Implement M486 to allow Marlin to skip objects
+ * Implement M486 to allow Marlin to skip objects.
+ * The moves of canceled objects are dropped as they are read.
  */
 //#define CANCEL_OBJECTS
 
@@ -76,4 +76,71 @@ extern "C" {
 
 #endif // !SDSUPPORT
 
+// ------------------------
+// ADC
+// ------------------------
+
+#if ENABLED(ADC_BACKGROUND_FILTER)
+
+  static volatile int8_t scan_slot = -1;  // Slot being converted, -1 until the scan starts
+  static int8_t read_slot = -1;           // Slot selected by HAL_START_ADC
+
+  static inline void adc_select(const uint8_t ch) {
+    #ifdef MUX5
+      ADCSRB = (ch > 7 ? _BV(MUX5) : 0) | _BV(ADTS2); // Trigger on Timer0 overflow
+    #else
+      ADCSRB = _BV(ADTS2);
+    #endif
+    ADMUX = _BV(REFS0) | (ch & 0x07);
+  }
+
+  void HAL_adc_init() {
+    ADCSRA = _BV(ADEN) | _BV(ADIF) | 0x07;
+    DIDR0 = 0;
+    #ifdef DIDR2
+      DIDR2 = 0;
+    #endif
+    FilteredADC::init();
+  }
+
+  void HAL_adc_enable_channel(const uint8_t ch) {
+    HAL_DIGITAL_INPUT_OFF(ch);
+    const int8_t slot = FilteredADC::enable_channel(ch);
+    if (slot < 0 || scan_slot >= 0) return;
+    // Prime the filter with one conversion while the scan is stopped
+    adc_select(ch);
+    SBI(ADCSRA, ADSC);
+    while (TEST(ADCSRA, ADSC)) { /* nada */ }
+    FilteredADC::sample(slot, ADC);
+  }
+
+  void HAL_adc_start_conversion(const uint8_t ch) {
+    read_slot = FilteredADC::index(ch); // Nothing to start. Select the filtered channel.
+    if (scan_slot < 0 && read_slot >= 0) {
+      // Start the scan on the first request, once all channels are enabled
+      scan_slot = read_slot;
+      adc_select(ch);
+      ADCSRA = _BV(ADEN) | _BV(ADATE) | _BV(ADIE) | _BV(ADIF) | 0x07;
+    }
+  }
+
+  uint16_t HAL_adc_get_result() {
+    if (read_slot < 0) return 0;
+    CRITICAL_SECTION_START(); // The ADC ISR may update the filter meanwhile
+    const uint16_t value = FilteredADC::read(read_slot);
+    CRITICAL_SECTION_END();
+    return value;
+  }
+
+  // A conversion has completed. Filter it and set up the next channel for the next trigger.
+  ISR(ADC_vect, ISR_NOBLOCK) {
+    int8_t slot = scan_slot;
+    FilteredADC::sample(slot, ADC);
+    do { if (++slot >= ADC_FILTER_CHANNELS) slot = 0; } while (!FilteredADC::enabled(slot));
+    scan_slot = slot;
+    adc_select(FilteredADC::pin(slot));
+  }
+
+#endif // ADC_BACKGROUND_FILTER
+
 #endif // __AVR__
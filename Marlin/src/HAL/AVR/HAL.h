@@ -358,29 +358,56 @@ void TIMER0_COMPB_vect_bottom()
 
 // ADC
 #ifdef DIDR2
-  #define HAL_ANALOG_SELECT(ind) do{ if (ind < 8) SBI(DIDR0, ind); else SBI(DIDR2, ind & 0x07); }while(0)
+  #define HAL_DIGITAL_INPUT_OFF(ind) do{ if (ind < 8) SBI(DIDR0, ind); else SBI(DIDR2, ind & 0x07); }while(0)
 #else
-  #define HAL_ANALOG_SELECT(ind) SBI(DIDR0, ind);
+  #define HAL_DIGITAL_INPUT_OFF(ind) SBI(DIDR0, ind);
 #endif
 
-inline void HAL_adc_init() {
-  ADCSRA = _BV(ADEN) | _BV(ADSC) | _BV(ADIF) | 0x07;
-  DIDR0 = 0;
-  #ifdef DIDR2
-    DIDR2 = 0;
-  #endif
-}
+#define HAL_ADC_RESOLUTION 10
+
+#if ENABLED(ADC_BACKGROUND_FILTER)
+
+  #include "../shared/adc_filter.h"
+
+  #define HAL_ADC_FILTERED    // Disable oversampling done in Marlin as ADC values are filtered in the background
+  #define ADC_FILTER_CHANNELS 8
+
+  // The ADC converts on every Timer0 overflow (~977Hz), taking the enabled channels in turn
+  using FilteredADC = ADCFilter<ADC_FILTER_CHANNELS, ADC_FILTER_MEDIAN_SIZE, ADC_FILTER_LOWPASS_K, ADC_FILTER_GLITCH_LIMIT, ADC_FILTER_GLITCH_COUNT>;
+
+  void HAL_adc_init();
+  void HAL_adc_enable_channel(const uint8_t ch);
+  void HAL_adc_start_conversion(const uint8_t ch);
+  uint16_t HAL_adc_get_result();
+
+  #define HAL_ANALOG_SELECT(ind) HAL_adc_enable_channel(ind)
+  #define HAL_START_ADC(ch)      HAL_adc_start_conversion(ch)
+  #define HAL_READ_ADC()         HAL_adc_get_result()
+  #define HAL_ADC_READY()        true
 
-#define SET_ADMUX_ADCSRA(ch) ADMUX = _BV(REFS0) | (ch & 0x07); SBI(ADCSRA, ADSC)
-#ifdef MUX5
-  #define HAL_START_ADC(ch) if (ch > 7) ADCSRB = _BV(MUX5); else ADCSRB = 0; SET_ADMUX_ADCSRA(ch)
 #else
-  #define HAL_START_ADC(ch) ADCSRB = 0; SET_ADMUX_ADCSRA(ch)
-#endif
 
-#define HAL_ADC_RESOLUTION 10
-#define HAL_READ_ADC()  ADC
-#define HAL_ADC_READY() !TEST(ADCSRA, ADSC)
+  #define HAL_ANALOG_SELECT(ind) HAL_DIGITAL_INPUT_OFF(ind)
+
+  inline void HAL_adc_init() {
+    ADCSRA = _BV(ADEN) | _BV(ADSC) | _BV(ADIF) | 0x07;
+    DIDR0 = 0;
+    #ifdef DIDR2
+      DIDR2 = 0;
+    #endif
+  }
+
+  #define SET_ADMUX_ADCSRA(ch) ADMUX = _BV(REFS0) | (ch & 0x07); SBI(ADCSRA, ADSC)
+  #ifdef MUX5
+    #define HAL_START_ADC(ch) if (ch > 7) ADCSRB = _BV(MUX5); else ADCSRB = 0; SET_ADMUX_ADCSRA(ch)
+  #else
+    #define HAL_START_ADC(ch) ADCSRB = 0; SET_ADMUX_ADCSRA(ch)
+  #endif
+
+  #define HAL_READ_ADC()  ADC
+  #define HAL_ADC_READY() !TEST(ADCSRA, ADSC)
+
+#endif
 
 #define GET_PIN_MAP_PIN(index) index
 #define GET_PIN_MAP_INDEX(pin) pin
@@ -51,6 +51,51 @@ int freeMemory() {
 // ADC
 // ------------------------
 
+#if ENABLED(ADC_BACKGROUND_FILTER)
+
+#include "hardware/Timer.h"
+
+static Timer adc_timer;
+static int8_t active_slot = -1;
+
+static uint16_t adc_sample_pin(const uint8_t ch) {
+  pin_t pin = analogInputToDigitalPin(ch);
+  if (!VALID_PIN(pin)) return 0;
+  return (Gpio::get(pin) >> 2) & 0x3FF;
+}
+
+// Sampling "interrupt" standing in for a DMA transfer of all enabled channels
+void HAL_adc_scan() {
+  for (uint8_t i = 0; i < ADC_FILTER_CHANNELS; i++)
+    if (FilteredADC::enabled(i)) FilteredADC::sample(i, adc_sample_pin(FilteredADC::pin(i)));
+}
+
+void HAL_adc_init() {
+  FilteredADC::init();
+  adc_timer.init(2, 1000000, HAL_adc_scan);
+  adc_timer.start(ADC_FILTER_SAMPLE_RATE);
+  adc_timer.enable();
+}
+
+void HAL_adc_enable_channel(const uint8_t ch) {
+  const int8_t slot = FilteredADC::enable_channel(ch);
+  if (slot >= 0) FilteredADC::sample(slot, adc_sample_pin(ch)); // Prime the filter
+}
+
+void HAL_adc_start_conversion(const uint8_t ch) {
+  active_slot = FilteredADC::index(ch); // Nothing to start. Select the filtered channel.
+}
+
+bool HAL_adc_finished() {
+  return true;
+}
+
+uint16_t HAL_adc_get_result() {
+  return active_slot >= 0 ? FilteredADC::read(active_slot) : 0;
+}
+
+#else
+
 void HAL_adc_init() {
 
 }
@@ -75,6 +120,8 @@ uint16_t HAL_adc_get_result() {
   return data;    // return 10bit value as Marlin expects
 }
 
+#endif // ADC_BACKGROUND_FILTER
+
 void HAL_pwm_init() {
 
 }
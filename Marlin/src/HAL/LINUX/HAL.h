@@ -93,6 +93,17 @@ int freeMemory();
 #define HAL_READ_ADC()        HAL_adc_get_result()
 #define HAL_ADC_READY()       true
 
+#if ENABLED(ADC_BACKGROUND_FILTER)
+  #include "../shared/adc_filter.h"
+
+  #define HAL_ADC_FILTERED    // Disable oversampling done in Marlin as ADC values are filtered in the background
+  #define ADC_FILTER_CHANNELS 16
+
+  // Emulates a DMA scan: every enabled channel is sampled at ADC_FILTER_SAMPLE_RATE
+  using FilteredADC = ADCFilter<ADC_FILTER_CHANNELS, ADC_FILTER_MEDIAN_SIZE, ADC_FILTER_LOWPASS_K, ADC_FILTER_GLITCH_LIMIT, ADC_FILTER_GLITCH_COUNT>;
+  void HAL_adc_scan();
+#endif
+
 void HAL_adc_init();
 void HAL_adc_enable_channel(const uint8_t ch);
 void HAL_adc_start_conversion(const uint8_t ch);
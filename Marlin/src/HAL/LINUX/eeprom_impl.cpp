@@ -24,7 +24,55 @@
 
 #include "../../inc/MarlinConfig.h"
 
-#if ENABLED(EEPROM_SETTINGS)
+#if ENABLED(EEPROM_JOURNAL)
+
+#include "../shared/eeprom_journal.h"
+#include <stdio.h>
+
+// The journal medium is a file. Like flash, programming can only clear bits.
+static FILE *journal_file = nullptr;
+static char journal_filename[] = "eeprom_journal.dat";
+
+bool journal_medium_open() {
+  if (journal_file) return false;
+  journal_file = fopen(journal_filename, "r+b");
+  if (journal_file == nullptr) journal_file = fopen(journal_filename, "w+b");
+  if (journal_file == nullptr) return true;
+
+  // Erase the pages missing from a new or shorter file
+  fseek(journal_file, 0L, SEEK_END);
+  const long file_size = ftell(journal_file);
+  for (uint8_t p = 0; p < EEPROM_JOURNAL_PAGES; p++)
+    if (long(p + 1) * (EEPROM_JOURNAL_PAGE_SIZE) > file_size && journal_medium_erase(p)) return true;
+  return false;
+}
+
+bool journal_medium_read(const uint32_t addr, void * const dst, const size_t size) {
+  return fseek(journal_file, addr, SEEK_SET) || fread(dst, 1, size, journal_file) != size;
+}
+
+bool journal_medium_program(const uint32_t addr, const void * const src, const size_t size) {
+  const uint8_t *in = (const uint8_t*)src;
+  uint8_t data[64];
+  for (size_t done = 0; done < size;) {
+    const size_t n = _MIN(size - done, sizeof(data));
+    if (journal_medium_read(addr + done, data, n)) return true;
+    for (size_t i = 0; i < n; i++) data[i] &= in[done + i];
+    if (fseek(journal_file, addr + done, SEEK_SET) || fwrite(data, 1, n, journal_file) != n) return true;
+    done += n;
+  }
+  return fflush(journal_file);
+}
+
+bool journal_medium_erase(const uint8_t page) {
+  uint8_t blank[EEPROM_JOURNAL_PAGE_SIZE];
+  memset(blank, 0xFF, sizeof(blank));
+  return fseek(journal_file, long(page) * (EEPROM_JOURNAL_PAGE_SIZE), SEEK_SET)
+      || fwrite(blank, 1, sizeof(blank), journal_file) != sizeof(blank)
+      || fflush(journal_file);
+}
+
+#elif ENABLED(EEPROM_SETTINGS)
 
 #include "../shared/eeprom_api.h"
 #include <stdio.h>
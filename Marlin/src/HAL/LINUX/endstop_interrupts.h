@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Endstop Interrupts
+ *
+ * The simulated endstop pins raise an edge event whenever they change state,
+ * so endstops.update() is called at the edge instead of at the next poll.
+ */
+
+#include "../../module/endstops.h"
+#include "hardware/Gpio.h"
+
+// One ISR for all endstop edges
+void endstop_ISR() { endstops.update(); }
+
+class EndstopEdge : public Peripheral {
+public:
+  void update() override {}
+  void interrupt(GpioEvent ev) override {
+    if (ev.event == GpioEvent::RISE || ev.event == GpioEvent::FALL) endstop_ISR();
+  }
+};
+
+void setup_endstop_interrupts() {
+  static EndstopEdge edge;
+  #define _ATTACH(P) Gpio::attachPeripheral(P, &edge)
+  #if HAS_X_MAX
+    _ATTACH(X_MAX_PIN);
+  #endif
+  #if HAS_X_MIN
+    _ATTACH(X_MIN_PIN);
+  #endif
+  #if HAS_Y_MAX
+    _ATTACH(Y_MAX_PIN);
+  #endif
+  #if HAS_Y_MIN
+    _ATTACH(Y_MIN_PIN);
+  #endif
+  #if HAS_Z_MAX
+    _ATTACH(Z_MAX_PIN);
+  #endif
+  #if HAS_Z_MIN
+    _ATTACH(Z_MIN_PIN);
+  #endif
+  #if HAS_Z_MIN_PROBE_PIN
+    _ATTACH(Z_MIN_PROBE_PIN);
+  #endif
+}
@@ -56,7 +56,9 @@ void LinearAxis::interrupt(GpioEvent ev) {
     if (ev.event == GpioEvent::RISE) {
       last_update = ev.timestamp;
       position += -1 + 2 * Gpio::pin_map[dir_pin].value;
-      Gpio::pin_map[min_pin].value = (position < min_position);
+      // Set through Gpio so a change is seen as an edge
+      const bool hit = position < min_position;
+      if (hit != bool(Gpio::get(min_pin))) Gpio::set(min_pin, hit);
       //Gpio::pin_map[max_pin].value = (position > max_position);
       //if (position < min_position) printf("axis(%d) endstop : pos: %d, mm: %f, min: %d\n", step_pin, position, position / 80.0, Gpio::pin_map[min_pin].value);
     }
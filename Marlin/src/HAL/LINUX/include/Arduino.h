@@ -90,6 +90,7 @@ using std::memcpy;
 #define strcpy_P strcpy
 #define snprintf_P snprintf
 #define strlen_P strlen
+#define strcasecmp_P strcasecmp
 
 // Time functions
 extern "C" {
@@ -98,6 +99,7 @@ extern "C" {
 void _delay_ms(const int delay);
 void delayMicroseconds(unsigned long);
 uint32_t millis();
+uint32_t micros();
 
 //IO functions
 void pinMode(const pin_t, const uint8_t);
@@ -0,0 +1,126 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Per-channel ADC filter for HALs that sample in the background
+ *
+ * The HAL pushes every raw conversion of an enabled channel into sample(),
+ * typically from a DMA-complete or scan interrupt. Temperature::isr then
+ * fetches the filtered value with read() and skips its own oversampling
+ * (HAL_ADC_FILTERED).
+ *
+ * Each channel passes through three stages:
+ *  - Glitch rejection: a sample further than GLITCH_LIMIT from the current
+ *    median is dropped, unless GLITCH_COUNT of them arrive in a row.
+ *  - Median of the last MEDIAN_SIZE accepted samples.
+ *  - First-order IIR low-pass, y += (x - y) / 2^LOWPASS_K.
+ */
+
+#include <stdint.h>
+
+template <uint8_t CHANNELS, uint8_t MEDIAN_SIZE, uint8_t LOWPASS_K, uint16_t GLITCH_LIMIT, uint8_t GLITCH_COUNT>
+class ADCFilter {
+  static_assert(MEDIAN_SIZE >= 1 && MEDIAN_SIZE <= 15 && (MEDIAN_SIZE & 1), "ADC_FILTER_MEDIAN_SIZE must be an odd value from 1 to 15.");
+  static_assert(LOWPASS_K <= 8, "ADC_FILTER_LOWPASS_K must be 8 or less.");
+
+  typedef struct {
+    uint8_t pin;                  // ADC channel, or 0xFF for an unused slot
+    uint8_t head, count, glitches;
+    uint16_t ring[MEDIAN_SIZE];
+    uint16_t median;
+    int32_t lowpass;              // 16.16 fixed point. Raw values are at most 15 bits.
+  } channel_t;
+
+  static channel_t channel[CHANNELS];
+
+public:
+
+  static void init() {
+    for (uint8_t i = 0; i < CHANNELS; i++) channel[i].pin = 0xFF;
+  }
+
+  // Claim a slot for a channel. Return the slot index or -1 if all slots are used.
+  static int8_t enable_channel(const uint8_t pin) {
+    int8_t slot = index(pin);
+    if (slot >= 0) return slot;
+    for (uint8_t i = 0; i < CHANNELS; i++)
+      if (channel[i].pin == 0xFF) {
+        channel_t &c = channel[i];
+        c.head = c.count = c.glitches = 0;
+        c.median = 0;
+        c.lowpass = 0;
+        c.pin = pin;
+        return i;
+      }
+    return -1;
+  }
+
+  static int8_t index(const uint8_t pin) {
+    for (uint8_t i = 0; i < CHANNELS; i++) if (channel[i].pin == pin) return i;
+    return -1;
+  }
+
+  static inline bool enabled(const uint8_t slot) { return channel[slot].pin != 0xFF; }
+  static inline uint8_t pin(const uint8_t slot) { return channel[slot].pin; }
+
+  // Feed a raw conversion into a channel's filter chain. Call from the sampling ISR.
+  static void sample(const uint8_t slot, const uint16_t raw) {
+    channel_t &c = channel[slot];
+
+    if (GLITCH_LIMIT && c.count == MEDIAN_SIZE) {
+      const uint16_t diff = raw > c.median ? raw - c.median : c.median - raw;
+      if (diff > GLITCH_LIMIT && ++c.glitches < GLITCH_COUNT) return;
+    }
+    c.glitches = 0;
+
+    c.ring[c.head] = raw;
+    if (++c.head >= MEDIAN_SIZE) c.head = 0;
+    const bool first = !c.count;
+    if (c.count < MEDIAN_SIZE) c.count++;
+
+    // Insertion sort of a handful of samples is cheaper than any selection algorithm
+    uint16_t sorted[MEDIAN_SIZE];
+    for (uint8_t i = 0; i < c.count; i++) {
+      const uint16_t v = c.ring[i];
+      uint8_t j = i;
+      for (; j && sorted[j - 1] > v; j--) sorted[j] = sorted[j - 1];
+      sorted[j] = v;
+    }
+    c.median = sorted[c.count >> 1];
+
+    const int32_t target = int32_t(c.median) << 16;
+    if (first)
+      c.lowpass = target;
+    else
+      c.lowpass += (target - c.lowpass) >> LOWPASS_K;
+  }
+
+  // The latest filtered value of a slot
+  static inline uint16_t read(const uint8_t slot) {
+    return uint16_t((channel[slot].lowpass + 0x8000) >> 16);
+  }
+};
+
+template <uint8_t CHANNELS, uint8_t MEDIAN_SIZE, uint8_t LOWPASS_K, uint16_t GLITCH_LIMIT, uint8_t GLITCH_COUNT>
+typename ADCFilter<CHANNELS, MEDIAN_SIZE, LOWPASS_K, GLITCH_LIMIT, GLITCH_COUNT>::channel_t
+  ADCFilter<CHANNELS, MEDIAN_SIZE, LOWPASS_K, GLITCH_LIMIT, GLITCH_COUNT>::channel[CHANNELS];
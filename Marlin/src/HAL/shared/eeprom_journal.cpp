@@ -0,0 +1,318 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Description: PersistentStore as a log of changed blocks on a page-erased medium.
+ * Not platform dependent. See eeprom_journal.h.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(EEPROM_JOURNAL)
+
+#include "eeprom_api.h"
+#include "eeprom_journal.h"
+
+#define PAGE_MAGIC    0x4A4C // "JL"
+#define COMMIT_RECORD 0xFFFE // block number of the record that closes a transaction
+#define NO_RECORD     0xFFFF
+
+#define PAGES         (EEPROM_JOURNAL_PAGES)
+#define RECORDS       (EEPROM_JOURNAL_PAGE_RECORDS)
+#define BLOCKS        (EEPROM_JOURNAL_BLOCKS)
+
+// Room kept free for a collection to copy a whole page and commit it
+#define SPARE_RECORDS (2 * (RECORDS))
+
+static_assert((EEPROM_JOURNAL_SIZE) % (EEPROM_JOURNAL_BLOCK) == 0, "EEPROM_JOURNAL_SIZE must be a multiple of 16.");
+static_assert(WITHIN(PAGES, 4, 250), "EEPROM_JOURNAL_PAGES must be from 4 to 250.");
+static_assert(2 * (BLOCKS + 1) <= (PAGES - 3) * (RECORDS), "EEPROM_JOURNAL_PAGES * EEPROM_JOURNAL_PAGE_SIZE is too small for EEPROM_JOURNAL_SIZE.");
+static_assert(uint32_t(PAGES) * (RECORDS) < NO_RECORD, "EEPROM_JOURNAL_PAGES * EEPROM_JOURNAL_PAGE_SIZE is too large.");
+
+typedef struct {
+  uint16_t magic, seq, crc, reserved;
+} journal_page_t;
+
+typedef struct {
+  uint16_t block, txn;                      // For a commit record data[0..1] holds the record count
+  uint8_t data[EEPROM_JOURNAL_BLOCK];
+  uint16_t crc, reserved;
+} journal_record_t;
+
+static_assert(sizeof(journal_page_t) == EEPROM_JOURNAL_PAGE_HEADER, "journal_page_t has the wrong size.");
+static_assert(sizeof(journal_record_t) == EEPROM_JOURNAL_RECORD, "journal_record_t has the wrong size.");
+
+static uint8_t image[EEPROM_JOURNAL_SIZE], dirty[(BLOCKS + 7) / 8];
+static uint16_t block_loc[BLOCKS];          // Record with the committed copy of each block, as page * RECORDS + slot
+
+static bool mounted;
+static uint8_t tail, used;                  // Oldest page and number of pages in the log
+static uint16_t head_seq, slot, last_txn;   // Sequence of the newest page, its next free record, the last transaction written
+
+static inline uint8_t page_after(const uint8_t p, const uint8_t n=1) { return (p + n) % PAGES; }
+static inline uint8_t head() { return page_after(tail, used - 1); }
+
+static inline uint32_t page_addr(const uint8_t p) { return uint32_t(p) * (EEPROM_JOURNAL_PAGE_SIZE); }
+static inline uint32_t record_addr(const uint8_t p, const uint16_t s) { return page_addr(p) + EEPROM_JOURNAL_PAGE_HEADER + uint32_t(s) * EEPROM_JOURNAL_RECORD; }
+
+static inline bool read_record(const uint16_t loc, journal_record_t &r) {
+  return journal_medium_read(record_addr(loc / (RECORDS), loc % (RECORDS)), &r, sizeof(r));
+}
+
+static uint16_t record_crc(const journal_record_t &r) {
+  uint16_t crc = 0;
+  crc16(&crc, &r, offsetof(journal_record_t, crc));
+  return crc;
+}
+
+static uint16_t page_crc(const journal_page_t &h) {
+  uint16_t crc = 0;
+  crc16(&crc, &h, offsetof(journal_page_t, crc));
+  return crc;
+}
+
+static bool is_blank(const void * const data, size_t size) {
+  for (const uint8_t *b = (const uint8_t*)data; size--;) if (*b++ != 0xFF) return false;
+  return true;
+}
+
+static uint32_t free_records() {
+  return used ? (RECORDS - slot) + uint32_t(PAGES - used) * (RECORDS) : uint32_t(PAGES) * (RECORDS);
+}
+
+// Start the next page of the ring, erasing it first if an interrupted erase left anything behind
+static bool open_page() {
+  const uint8_t p = used ? page_after(head()) : tail;
+  uint8_t buffer[EEPROM_JOURNAL_RECORD];
+  for (uint32_t a = 0; a < EEPROM_JOURNAL_PAGE_SIZE; a += sizeof(buffer)) {
+    const size_t n = _MIN(sizeof(buffer), size_t(EEPROM_JOURNAL_PAGE_SIZE - a));
+    if (journal_medium_read(page_addr(p) + a, buffer, n)) return true;
+    if (!is_blank(buffer, n)) {
+      if (journal_medium_erase(p)) return true;
+      break;
+    }
+  }
+  journal_page_t h = { PAGE_MAGIC, uint16_t(head_seq + 1), 0, 0xFFFF };
+  h.crc = page_crc(h);
+  if (journal_medium_program(page_addr(p), &h, sizeof(h))) return true;
+  head_seq++;
+  used++;
+  slot = 0;
+  return false;
+}
+
+static bool append(const uint16_t block, const uint16_t txn, const void * const data) {
+  if (slot >= RECORDS || !used) if (open_page()) return true;
+  journal_record_t r;
+  r.block = block;
+  r.txn = txn;
+  memcpy(r.data, data, sizeof(r.data));
+  r.reserved = 0xFFFF;
+  r.crc = record_crc(r);
+  if (journal_medium_program(record_addr(head(), slot), &r, sizeof(r))) return true;
+  slot++;
+  last_txn = txn;
+  if (block < BLOCKS) block_loc[block] = head() * (RECORDS) + slot - 1;
+  return false;
+}
+
+static bool append_commit(const uint16_t txn, const uint16_t count) {
+  uint8_t data[EEPROM_JOURNAL_BLOCK];
+  memset(data, 0xFF, sizeof(data));
+  data[0] = count & 0xFF;
+  data[1] = count >> 8;
+  return append(COMMIT_RECORD, txn, data);
+}
+
+// Copy the blocks still current in the oldest page to the head, then erase it
+static bool collect() {
+  if (used < 2) return true;
+  const uint16_t txn = last_txn + 1;
+  uint16_t count = 0;
+  for (uint16_t b = 0; b < BLOCKS; b++)
+    if (block_loc[b] != NO_RECORD && block_loc[b] / (RECORDS) == tail) {
+      // Copy the committed record. The image may already hold unsaved changes.
+      journal_record_t r;
+      if (read_record(block_loc[b], r) || r.crc != record_crc(r) || append(b, txn, r.data)) return true;
+      count++;
+    }
+  if (count && append_commit(txn, count)) return true;
+  if (journal_medium_erase(tail)) return true;
+  tail = page_after(tail);
+  used--;
+  return false;
+}
+
+static bool make_room(const uint16_t records) {
+  for (uint8_t tries = PAGES; free_records() < uint32_t(records) + SPARE_RECORDS;)
+    if (!tries-- || collect()) return true;
+  return false;
+}
+
+/**
+ * Apply the records of a committed transaction, from the run index and
+ * slot where it started up to the commit record.
+ */
+static bool replay(uint8_t k, uint16_t s, const uint8_t end_k, const uint16_t end_s, const uint16_t txn) {
+  journal_record_t r;
+  while (k < end_k || (k == end_k && s < end_s)) {
+    const uint8_t p = page_after(tail, k);
+    if (journal_medium_read(record_addr(p, s), &r, sizeof(r))) return true;
+    if (r.txn == txn && r.block < BLOCKS && r.crc == record_crc(r)) {
+      memcpy(&image[r.block * EEPROM_JOURNAL_BLOCK], r.data, sizeof(r.data));
+      block_loc[r.block] = p * (RECORDS) + s;
+    }
+    if (++s >= RECORDS) { s = 0; k++; }
+  }
+  return false;
+}
+
+/**
+ * Find the log and read it back into the image. The log is the longest run
+ * of pages with valid headers and consecutive sequence numbers. Anything
+ * else on the medium is left over from an interrupted erase and is erased.
+ */
+static bool journal_mount() {
+  if (journal_medium_open()) return false;
+
+  memset(image, 0xFF, sizeof(image));
+  memset(dirty, 0, sizeof(dirty));
+  for (uint16_t b = 0; b < BLOCKS; b++) block_loc[b] = NO_RECORD;
+  tail = used = 0;
+  head_seq = slot = last_txn = 0;
+
+  uint16_t seq[PAGES];
+  bool valid[PAGES];
+  for (uint8_t p = 0; p < PAGES; p++) {
+    journal_page_t h;
+    if (journal_medium_read(page_addr(p), &h, sizeof(h))) return false;
+    valid[p] = h.magic == PAGE_MAGIC && h.crc == page_crc(h);
+    seq[p] = h.seq;
+  }
+
+  #define FOLLOWS(P,Q) (valid[P] && valid[Q] && seq[Q] == uint16_t(seq[P] + 1))
+  for (uint8_t p = 0; p < PAGES; p++) {
+    const uint8_t prev = page_after(p, PAGES - 1);
+    if (!valid[p] || FOLLOWS(prev, p)) continue;
+    uint8_t n = 1;
+    while (n < PAGES && FOLLOWS(page_after(p, n - 1), page_after(p, n))) n++;
+    if (n > used) { tail = p; used = n; }
+  }
+  #undef FOLLOWS
+
+  for (uint8_t k = used; k < PAGES; k++) {
+    const uint8_t p = page_after(tail, k);
+    journal_page_t h;
+    if (journal_medium_read(page_addr(p), &h, sizeof(h))) return false;
+    if (!is_blank(&h, sizeof(h)) && journal_medium_erase(p)) return false;
+  }
+
+  if (!used) return true;
+  head_seq = seq[head()];
+
+  // Walk the log. A transaction counts once its commit record is found
+  // with the right number of records before it.
+  bool open = false;
+  uint8_t start_k = 0;
+  uint16_t start_s = 0, open_txn = 0, pending = 0;
+  slot = RECORDS;
+  for (uint8_t k = 0; k < used; k++) {
+    const uint8_t p = page_after(tail, k);
+    for (uint16_t s = 0; s < RECORDS; s++) {
+      journal_record_t r;
+      if (journal_medium_read(record_addr(p, s), &r, sizeof(r))) return false;
+      if (is_blank(&r, sizeof(r))) {
+        if (k == used - 1) { slot = s; k = used; }
+        break;
+      }
+      if (r.crc != record_crc(r)) { open = false; continue; } // Torn write
+      last_txn = r.txn;
+      if (r.block == COMMIT_RECORD) {
+        if (open && r.txn == open_txn && pending == (r.data[0] | (r.data[1] << 8)))
+          if (replay(start_k, start_s, k, s, open_txn)) return false;
+        open = false;
+      }
+      else if (r.block < BLOCKS) {
+        if (!open || r.txn != open_txn) {
+          open = true;
+          open_txn = r.txn;
+          start_k = k;
+          start_s = s;
+          pending = 0;
+        }
+        pending++;
+      }
+    }
+  }
+  return true;
+}
+
+// Append the changed blocks as one transaction
+static bool journal_commit() {
+  uint16_t count = 0;
+  for (uint16_t b = 0; b < BLOCKS; b++) if (TEST(dirty[b >> 3], b & 7)) count++;
+  if (!count) return false;
+  if (make_room(count + 1)) return true;
+
+  const uint16_t txn = last_txn + 1;
+  for (uint16_t b = 0; b < BLOCKS; b++)
+    if (TEST(dirty[b >> 3], b & 7) && append(b, txn, &image[b * EEPROM_JOURNAL_BLOCK])) return true;
+  if (append_commit(txn, count)) return true;
+
+  memset(dirty, 0, sizeof(dirty));
+  return false;
+}
+
+bool PersistentStore::access_start() {
+  if (!mounted) mounted = journal_mount();
+  return mounted;
+}
+
+bool PersistentStore::access_finish() {
+  if (!journal_commit()) return true;
+  mounted = false; // Read the log back on the next access
+  return false;
+}
+
+bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  if (pos < 0 || pos + size > EEPROM_JOURNAL_SIZE) return true;
+  crc16(crc, value, size);
+  for (; size--; pos++, value++)
+    if (image[pos] != *value) {
+      image[pos] = *value;
+      const uint16_t b = pos / EEPROM_JOURNAL_BLOCK;
+      SBI(dirty[b >> 3], b & 7);
+    }
+  return false;
+}
+
+bool PersistentStore::read_data(int &pos, uint8_t* value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
+  if (pos < 0 || pos + size > EEPROM_JOURNAL_SIZE) return true;
+  crc16(crc, &image[pos], size);
+  if (writing) memcpy(value, &image[pos], size);
+  pos += size;
+  return false;
+}
+
+size_t PersistentStore::capacity() { return EEPROM_JOURNAL_SIZE; }
+
+#endif // EEPROM_JOURNAL
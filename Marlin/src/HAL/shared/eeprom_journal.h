@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Journaled settings store
+ *
+ * The settings image lives in RAM. Writes only mark the 16-byte blocks
+ * they change, and access_finish() appends those blocks to a log on the
+ * medium as one transaction, closed by a commit record. A transaction
+ * without its commit record is ignored when the log is read back, so a
+ * power cut leaves the last complete save in place.
+ *
+ * The log runs through the pages of the medium as a ring, so every page
+ * is erased in turn. Before the ring runs out of erased pages the blocks
+ * still current in the oldest page are copied to the head and the oldest
+ * page is erased.
+ *
+ * The HAL provides the medium: pages that are erased to 0xFF and can then
+ * be programmed once per byte.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define EEPROM_JOURNAL_BLOCK        16
+#define EEPROM_JOURNAL_BLOCKS       ((EEPROM_JOURNAL_SIZE) / (EEPROM_JOURNAL_BLOCK))
+#define EEPROM_JOURNAL_PAGE_HEADER  8
+#define EEPROM_JOURNAL_RECORD       24
+#define EEPROM_JOURNAL_PAGE_RECORDS (((EEPROM_JOURNAL_PAGE_SIZE) - (EEPROM_JOURNAL_PAGE_HEADER)) / (EEPROM_JOURNAL_RECORD))
+
+// Provided by the HAL. All return true on error, like PersistentStore::write_data.
+bool journal_medium_open();
+bool journal_medium_read(const uint32_t addr, void * const dst, const size_t size);
+bool journal_medium_program(const uint32_t addr, const void * const src, const size_t size);
+bool journal_medium_erase(const uint8_t page);
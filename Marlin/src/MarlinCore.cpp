@@ -145,6 +145,10 @@
   #include "feature/powerloss.h"
 #endif
 
+#if ENABLED(SD_FILE_ANALYSIS)
+  #include "feature/file_analysis.h"
+#endif
+
 #if ENABLED(CANCEL_OBJECTS)
   #include "feature/cancel_object.h"
 #endif
@@ -723,6 +727,14 @@ void idle(
     Sd2Card::idle();
   #endif
 
+  #if ENABLED(SD_FILE_ANALYSIS)
+    file_analysis.idle();
+  #endif
+
+  #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+    planner.apply_feedrate_percentage();
+  #endif
+
   #if ENABLED(PRUSA_MMU2)
     mmu2.mmu_loop();
   #endif
@@ -24,7 +24,7 @@
 #include "../inc/MarlinConfigPre.h"
 
 #if ENABLED(INTEGRATED_BABYSTEPPING)
-  #define BABYSTEPS_PER_SEC 1000UL
+  #define BABYSTEPS_PER_SEC uint32_t(BABYSTEP_MAX_RATE)
   #define BABYSTEP_TICKS ((STEPPER_TIMER_RATE) / (BABYSTEPS_PER_SEC))
 #else
   #define BABYSTEPS_PER_SEC 976UL
@@ -28,6 +28,7 @@
 
 #include "../module/motion.h"
 #include "../module/planner.h"
+#include "../module/stepper.h"
 
 #ifdef BACKLASH_DISTANCE_MM
   #if ENABLED(BACKLASH_GCODE)
@@ -39,9 +40,6 @@
 
 #if ENABLED(BACKLASH_GCODE)
   uint8_t Backlash::correction = (BACKLASH_CORRECTION) * 0xFF;
-  #ifdef BACKLASH_SMOOTHING_MM
-    float Backlash::smoothing_mm = BACKLASH_SMOOTHING_MM;
-  #endif
 #endif
 
 #if ENABLED(MEASURE_BACKLASH_WHEN_PROBING)
@@ -49,77 +47,50 @@
   xyz_uint8_t Backlash::measured_count{0};
 #endif
 
+xyz_long_t Backlash::residual_error{0},
+           Backlash::correction_steps{0};
+
 Backlash backlash;
 
 /**
- * To minimize seams in the printed part, backlash correction only adds
- * steps to the current segment (instead of creating a new segment, which
- * causes discontinuities and print artifacts).
+ * To minimize seams in the printed part, backlash correction doesn't change
+ * the planned moves. When an axis reverses, the slack is added to the steps
+ * taken up by the Stepper ISR at BACKLASH_CORRECTION_RATE alongside the move,
+ * so the planner does the same work with or without compensation.
  *
- * With a non-zero BACKLASH_SMOOTHING_MM value the backlash correction is
- * spread over multiple segments, smoothing out artifacts even more.
+ * Called by the planner for each block, so the steps follow M425, G425 and M92.
  */
+void Backlash::update_correction_steps() {
+  const float f_corr = float(correction) / 255.0f;
+  xyz_long_t steps;
+  LOOP_XYZ(axis) steps[axis] = LROUND(f_corr * distance_mm[axis] * planner.settings.axis_steps_per_mm[axis]);
+  if (steps != correction_steps) {
+    const bool was_enabled = stepper.suspend();
+    correction_steps = steps;
+    if (was_enabled) stepper.wake_up();
+  }
+}
 
-void Backlash::add_correction_steps(const int32_t &da, const int32_t &db, const int32_t &dc, const uint8_t dm, block_t * const block) {
+/**
+ * Called by the Stepper ISR as each block begins. Return 'true' if there are
+ * correction steps to take.
+ */
+bool Backlash::add_correction_steps(const block_t * const block) {
   static uint8_t last_direction_bits;
+  const uint8_t dm = block->direction_bits;
   uint8_t changed_dir = last_direction_bits ^ dm;
   // Ignore direction change if no steps are taken in that direction
-  if (da == 0) CBI(changed_dir, X_AXIS);
-  if (db == 0) CBI(changed_dir, Y_AXIS);
-  if (dc == 0) CBI(changed_dir, Z_AXIS);
+  if (!block->steps.a) CBI(changed_dir, X_AXIS);
+  if (!block->steps.b) CBI(changed_dir, Y_AXIS);
+  if (!block->steps.c) CBI(changed_dir, Z_AXIS);
   last_direction_bits ^= changed_dir;
 
-  if (correction == 0) return;
+  // When an axis changes direction, add axis backlash to the residual error
+  if (changed_dir) LOOP_XYZ(axis)
+    if (TEST(changed_dir, axis))
+      residual_error[axis] += TEST(dm, axis) ? -correction_steps[axis] : correction_steps[axis];
 
-  #ifdef BACKLASH_SMOOTHING_MM
-    // The segment proportion is a value greater than 0.0 indicating how much residual_error
-    // is corrected for in this segment. The contribution is based on segment length and the
-    // smoothing distance. Since the computation of this proportion involves a floating point
-    // division, defer computation until needed.
-    float segment_proportion = 0;
-
-    // Residual error carried forward across multiple segments, so correction can be applied
-    // to segments where there is no direction change.
-    static xyz_long_t residual_error{0};
-  #else
-    // No direction change, no correction.
-    if (!changed_dir) return;
-    // No leftover residual error from segment to segment
-    xyz_long_t residual_error{0};
-  #endif
-
-  const float f_corr = float(correction) / 255.0f;
-
-  LOOP_XYZ(axis) {
-    if (distance_mm[axis]) {
-      const bool reversing = TEST(dm,axis);
-
-      // When an axis changes direction, add axis backlash to the residual error
-      if (TEST(changed_dir, axis))
-        residual_error[axis] += (reversing ? -f_corr : f_corr) * distance_mm[axis] * planner.settings.axis_steps_per_mm[axis];
-
-      // Decide how much of the residual error to correct in this segment
-      int32_t error_correction = residual_error[axis];
-      #ifdef BACKLASH_SMOOTHING_MM
-        if (error_correction && smoothing_mm != 0) {
-          // Take up a portion of the residual_error in this segment, but only when
-          // the current segment travels in the same direction as the correction
-          if (reversing == (error_correction < 0)) {
-            if (segment_proportion == 0)
-              segment_proportion = _MIN(1.0f, block->millimeters / smoothing_mm);
-            error_correction = CEIL(segment_proportion * error_correction);
-          }
-          else
-            error_correction = 0; // Don't take up any backlash in this segment, as it would subtract steps
-        }
-      #endif
-      // Making a correction reduces the residual error and adds block steps
-      if (error_correction) {
-        block->steps[axis] += ABS(error_correction);
-        residual_error[axis] -= error_correction;
-      }
-    }
-  }
+  return residual_error.x || residual_error.y || residual_error.z;
 }
 
 #if ENABLED(MEASURE_BACKLASH_WHEN_PROBING)
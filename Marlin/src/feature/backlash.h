@@ -31,18 +31,12 @@ public:
   #if ENABLED(BACKLASH_GCODE)
     static xyz_float_t distance_mm;
     static uint8_t correction;
-    #ifdef BACKLASH_SMOOTHING_MM
-      static float smoothing_mm;
-    #endif
 
     static inline void set_correction(const float &v) { correction = _MAX(0, _MIN(1.0, v)) * all_on; }
     static inline float get_correction() { return float(ui8_to_percent(correction)) / 100.0f; }
   #else
     static constexpr uint8_t correction = (BACKLASH_CORRECTION) * 0xFF;
     static const xyz_float_t distance_mm;
-    #ifdef BACKLASH_SMOOTHING_MM
-      static constexpr float smoothing_mm = BACKLASH_SMOOTHING_MM;
-    #endif
   #endif
 
   #if ENABLED(MEASURE_BACKLASH_WHEN_PROBING)
@@ -81,7 +75,14 @@ public:
     return has_measurement(X_AXIS) || has_measurement(Y_AXIS) || has_measurement(Z_AXIS);
   }
 
-  void add_correction_steps(const int32_t &da, const int32_t &db, const int32_t &dc, const uint8_t dm, block_t * const block);
+  // Motor steps still to take to cross the slack, stepped by the Stepper ISR
+  static xyz_long_t residual_error;
+
+  // Motor steps of slack on each axis, with the correction applied
+  static xyz_long_t correction_steps;
+
+  static void update_correction_steps();
+  static bool add_correction_steps(const block_t * const block);
 };
 
 extern Backlash backlash;
@@ -346,72 +346,12 @@ float bilinear_z_offset(const xy_pos_t &raw) {
 
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
-  #define CELL_INDEX(A,V) ((V - bilinear_start.A) * ABL_BG_FACTOR(A))
-
-  /**
-   * Prepare a bilinear-leveled linear move on Cartesian,
-   * splitting the move where it crosses grid borders.
-   */
-  void bilinear_line_to_destination(const feedRate_t scaled_fr_mm_s, uint16_t x_splits, uint16_t y_splits) {
-    // Get current and destination cells for this line
-    xy_int_t c1 { CELL_INDEX(x, current_position.x), CELL_INDEX(y, current_position.y) },
-             c2 { CELL_INDEX(x, destination.x), CELL_INDEX(y, destination.y) };
-    LIMIT(c1.x, 0, ABL_BG_POINTS_X - 2);
-    LIMIT(c1.y, 0, ABL_BG_POINTS_Y - 2);
-    LIMIT(c2.x, 0, ABL_BG_POINTS_X - 2);
-    LIMIT(c2.y, 0, ABL_BG_POINTS_Y - 2);
-
-    // Start and end in the same cell? No split needed.
-    if (c1 == c2) {
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
-      return;
-    }
-
-    #define LINE_SEGMENT_END(A) (current_position.A + (destination.A - current_position.A) * normalized_dist)
-
-    float normalized_dist;
-    xyze_pos_t end;
-    const xy_int8_t gc { _MAX(c1.x, c2.x), _MAX(c1.y, c2.y) };
-
-    // Crosses on the X and not already split on this X?
-    // The x_splits flags are insurance against rounding errors.
-    if (c2.x != c1.x && TEST(x_splits, gc.x)) {
-      // Split on the X grid line
-      CBI(x_splits, gc.x);
-      end = destination;
-      destination.x = bilinear_start.x + ABL_BG_SPACING(x) * gc.x;
-      normalized_dist = (destination.x - current_position.x) / (end.x - current_position.x);
-      destination.y = LINE_SEGMENT_END(y);
-    }
-    // Crosses on the Y and not already split on this Y?
-    else if (c2.y != c1.y && TEST(y_splits, gc.y)) {
-      // Split on the Y grid line
-      CBI(y_splits, gc.y);
-      end = destination;
-      destination.y = bilinear_start.y + ABL_BG_SPACING(y) * gc.y;
-      normalized_dist = (destination.y - current_position.y) / (end.y - current_position.y);
-      destination.x = LINE_SEGMENT_END(x);
-    }
-    else {
-      // Must already have been split on these border(s)
-      // This should be a rare case.
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
-      return;
-    }
-
-    destination.z = LINE_SEGMENT_END(z);
-    destination.e = LINE_SEGMENT_END(e);
-
-    // Do the split and look for more borders
-    bilinear_line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
-
-    // Restore destination from stack
-    destination = end;
-    bilinear_line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
+  void get_mesh_grid(mesh_grid_t &grid) {
+    grid.start = bilinear_start;
+    grid.spacing.set(ABL_BG_SPACING(x), ABL_BG_SPACING(y));
+    grid.points.set(ABL_BG_POINTS_X, ABL_BG_POINTS_Y);
   }
 
-#endif // IS_CARTESIAN && !SEGMENT_LEVELED_MOVES
+#endif
 
 #endif // AUTO_BED_LEVELING_BILINEAR
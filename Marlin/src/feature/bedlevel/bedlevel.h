@@ -79,6 +79,15 @@ class TemporaryBedLevelingState {
      */
     void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, element_2d_fn fn);
 
+    #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+      /**
+       * The lines bounding the interpolation cells of the mesh.
+       * Leveled moves are split where they cross these lines.
+       */
+      typedef struct { xy_pos_t start, spacing; xy_uint8_t points; } mesh_grid_t;
+      void get_mesh_grid(mesh_grid_t &grid);
+    #endif
+
   #endif
 
   struct mesh_index_pair {
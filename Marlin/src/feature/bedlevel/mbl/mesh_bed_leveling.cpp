@@ -39,6 +39,8 @@
         mesh_bed_leveling::index_to_xpos[GRID_MAX_POINTS_X],
         mesh_bed_leveling::index_to_ypos[GRID_MAX_POINTS_Y];
 
+  mesh_cell_t mesh_bed_leveling::cells[GRID_MAX_POINTS_X - 1][GRID_MAX_POINTS_Y - 1];
+
   mesh_bed_leveling::mesh_bed_leveling() {
     LOOP_L_N(i, GRID_MAX_POINTS_X)
       index_to_xpos[i] = MESH_MIN_X + i * (MESH_X_DIST);
@@ -50,77 +52,126 @@
   void mesh_bed_leveling::reset() {
     z_offset = 0;
     ZERO(z_values);
+    ZERO(cells);
     #if ENABLED(EXTENSIBLE_UI)
       GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
     #endif
   }
 
-  #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+  #if ENABLED(MBL_BICUBIC_INTERPOLATION)
 
-    /**
-     * Prepare a mesh-leveled linear move in a Cartesian setup,
-     * splitting the move where it crosses mesh borders.
-     */
-    void mesh_bed_leveling::line_to_destination(const feedRate_t &scaled_fr_mm_s, uint8_t x_splits, uint8_t y_splits) {
-      // Get current and destination cells for this line
-      xy_int8_t scel = cell_indexes(current_position), ecel = cell_indexes(destination);
-      NOMORE(scel.x, GRID_MAX_POINTS_X - 2);
-      NOMORE(scel.y, GRID_MAX_POINTS_Y - 2);
-      NOMORE(ecel.x, GRID_MAX_POINTS_X - 2);
-      NOMORE(ecel.y, GRID_MAX_POINTS_Y - 2);
-
-      // Start and end in the same cell? No split needed.
-      if (scel == ecel) {
-        line_to_destination(scaled_fr_mm_s);
-        current_position = destination;
-        return;
-      }
+    // Mesh value with linear extrapolation one point beyond each edge
+    static float extended_z(const int8_t x, const int8_t y) {
+      if (x < 0)                  return 2 * extended_z(0, y) - extended_z(1, y);
+      if (x >= GRID_MAX_POINTS_X) return 2 * extended_z(GRID_MAX_POINTS_X - 1, y) - extended_z(GRID_MAX_POINTS_X - 2, y);
+      if (y < 0)                  return 2 * mbl.z_values[x][0] - mbl.z_values[x][1];
+      if (y >= GRID_MAX_POINTS_Y) return 2 * mbl.z_values[x][GRID_MAX_POINTS_Y - 1] - mbl.z_values[x][GRID_MAX_POINTS_Y - 2];
+      return mbl.z_values[x][y];
+    }
 
-      #define MBL_SEGMENT_END(A) (current_position.A + (destination.A - current_position.A) * normalized_dist)
-
-      float normalized_dist;
-      xyze_pos_t dest;
-      const int8_t gcx = _MAX(scel.x, ecel.x), gcy = _MAX(scel.y, ecel.y);
-
-      // Crosses on the X and not already split on this X?
-      // The x_splits flags are insurance against rounding errors.
-      if (ecel.x != scel.x && TEST(x_splits, gcx)) {
-        // Split on the X grid line
-        CBI(x_splits, gcx);
-        dest = destination;
-        destination.x = index_to_xpos[gcx];
-        normalized_dist = (destination.x - current_position.x) / (dest.x - current_position.x);
-        destination.y = MBL_SEGMENT_END(y);
-      }
-      // Crosses on the Y and not already split on this Y?
-      else if (ecel.y != scel.y && TEST(y_splits, gcy)) {
-        // Split on the Y grid line
-        CBI(y_splits, gcy);
-        dest = destination;
-        destination.y = index_to_ypos[gcy];
-        normalized_dist = (destination.y - current_position.y) / (dest.y - current_position.y);
-        destination.x = MBL_SEGMENT_END(x);
+    // Catmull-Rom basis. Row m gives the weights of the 4 points for the t^m term.
+    static const float catmull_rom[4][4] = {
+      {  0.0f,  1.0f,  0.0f,  0.0f },
+      { -0.5f,  0.0f,  0.5f,  0.0f },
+      {  1.0f, -2.5f,  2.0f, -0.5f },
+      { -0.5f,  1.5f, -1.5f,  0.5f }
+    };
+
+    static void refresh_cell(const int8_t cx, const int8_t cy) {
+      float p[4][4], q[4][4];
+      LOOP_L_N(i, 4) LOOP_L_N(j, 4) p[i][j] = extended_z(cx - 1 + i, cy - 1 + j);
+      // Columns first: q[i][n] = sum(B[n][j] * p[i][j])
+      LOOP_L_N(i, 4) LOOP_L_N(n, 4) {
+        float sum = 0;
+        LOOP_L_N(j, 4) sum += catmull_rom[n][j] * p[i][j];
+        q[i][n] = sum;
       }
-      else {
-        // Must already have been split on these border(s)
-        // This should be a rare case.
-        line_to_destination(scaled_fr_mm_s);
-        current_position = destination;
-        return;
+      // Then rows: c[m][n] = sum(B[m][i] * q[i][n])
+      mesh_cell_t &c = mbl.cells[cx][cy];
+      LOOP_L_N(m, 4) LOOP_L_N(n, 4) {
+        float sum = 0;
+        LOOP_L_N(i, 4) sum += catmull_rom[m][i] * q[i][n];
+        c.c[m][n] = sum;
       }
+    }
 
-      destination.z = MBL_SEGMENT_END(z);
-      destination.e = MBL_SEGMENT_END(e);
+    // A point influences the cells up to two columns and rows away
+    #define MBL_CELL_REACH 2
 
-      // Do the split and look for more borders
-      line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
+  #else
 
-      // Restore destination from stack
-      destination = dest;
-      line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
+    static void refresh_cell(const int8_t cx, const int8_t cy) {
+      const float z1 = mbl.z_values[cx][cy],     z2 = mbl.z_values[cx + 1][cy],
+                  z3 = mbl.z_values[cx][cy + 1], z4 = mbl.z_values[cx + 1][cy + 1];
+      mesh_cell_t &c = mbl.cells[cx][cy];
+      c.z0 = z1;
+      c.dx = (z2 - z1) * RECIPROCAL(MESH_X_DIST);
+      c.dy = (z3 - z1) * RECIPROCAL(MESH_Y_DIST);
+      c.dxy = (z4 - z3 - z2 + z1) * RECIPROCAL((MESH_X_DIST) * (MESH_Y_DIST));
     }
 
-  #endif // IS_CARTESIAN && !SEGMENT_LEVELED_MOVES
+    #define MBL_CELL_REACH 1
+
+  #endif
+
+  /**
+   * Rebuild the interpolation coefficients for the whole mesh.
+   * Call after z_values has been changed without set_z().
+   */
+  void mesh_bed_leveling::refresh() {
+    LOOP_L_N(cx, GRID_MAX_POINTS_X - 1) LOOP_L_N(cy, GRID_MAX_POINTS_Y - 1) refresh_cell(cx, cy);
+  }
+
+  // Rebuild only the cells that depend on the given mesh point
+  void mesh_bed_leveling::refresh_point(const int8_t px, const int8_t py) {
+    const int8_t x1 = _MAX(px - MBL_CELL_REACH, 0), x2 = _MIN(px + MBL_CELL_REACH - 1, GRID_MAX_POINTS_X - 2),
+                 y1 = _MAX(py - MBL_CELL_REACH, 0), y2 = _MIN(py + MBL_CELL_REACH - 1, GRID_MAX_POINTS_Y - 2);
+    for (int8_t cx = x1; cx <= x2; cx++)
+      for (int8_t cy = y1; cy <= y2; cy++)
+        refresh_cell(cx, cy);
+  }
+
+  /**
+   * Start the line evaluator in the cell containing 'pos'.
+   *
+   * With z(k) = z0 + B*x(k) + C*y(k) + D*x(k)*y(k) along x(k) = u + k*dx,
+   * y(k) = v + k*dy the first difference starts at L + Q and grows by 2Q,
+   * where L = B*dx + C*dy + D*(u*dy + v*dx) and Q = D*dx*dy.
+   */
+  void mesh_bed_leveling::line_evaluator::enter_cell() {
+    cell = cell_indexes(pos);
+    const float u = pos.x - index_to_xpos[cell.x],
+                v = pos.y - index_to_ypos[cell.y];
+    z = cell_z(cell, u, v);
+
+    #if ENABLED(MBL_BICUBIC_INTERPOLATION)
+      // Cubic patches are evaluated directly at every step
+      steps_in_cell = 0;
+    #else
+      const mesh_cell_t &c = cells[cell.x][cell.y];
+      const float q = c.dxy * step.x * step.y;
+      d1 = c.dx * step.x + c.dy * step.y + c.dxy * (u * step.y + v * step.x) + q;
+      d2 = 2 * q;
+
+      // Count the steps that stay within this cell. Edge cells extend beyond the mesh.
+      float n = 65535;
+      if (step.x > 0 && cell.x < GRID_MAX_POINTS_X - 2) NOMORE(n, (index_to_xpos[cell.x + 1] - pos.x) / step.x);
+      if (step.x < 0 && cell.x > 0)                     NOMORE(n, (index_to_xpos[cell.x] - pos.x) / step.x);
+      if (step.y > 0 && cell.y < GRID_MAX_POINTS_Y - 2) NOMORE(n, (index_to_ypos[cell.y + 1] - pos.y) / step.y);
+      if (step.y < 0 && cell.y > 0)                     NOMORE(n, (index_to_ypos[cell.y] - pos.y) / step.y);
+      steps_in_cell = n > 0 ? uint16_t(n) : 0;
+    #endif
+  }
+
+  #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+
+    void get_mesh_grid(mesh_grid_t &grid) {
+      grid.start.set(MESH_MIN_X, MESH_MIN_Y);
+      grid.spacing.set(MESH_X_DIST, MESH_Y_DIST);
+      grid.points.set(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y);
+    }
+
+  #endif
 
   void mesh_bed_leveling::report_mesh() {
     SERIAL_ECHOPAIR_F(STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh. Z offset: ", z_offset, 5);
@@ -38,6 +38,14 @@ enum MeshLevelingState : char {
 #define _GET_MESH_Y(J) mbl.index_to_ypos[J]
 #define Z_VALUES_ARR mbl.z_values
 
+#if ENABLED(MBL_BICUBIC_INTERPOLATION)
+  // Bicubic (Catmull-Rom) patch: z = sum(c[m][n] * t^m * s^n), t and s normalized to the cell
+  typedef struct { float c[4][4]; } mesh_cell_t;
+#else
+  // Bilinear patch: z = z0 + u * dx + v * (dy + u * dxy), u and v in mm from the cell origin
+  typedef struct { float z0, dx, dy, dxy; } mesh_cell_t;
+#endif
+
 class mesh_bed_leveling {
 public:
   static float z_offset,
@@ -45,18 +53,24 @@ public:
                index_to_xpos[GRID_MAX_POINTS_X],
                index_to_ypos[GRID_MAX_POINTS_Y];
 
+  // Interpolation coefficients. Call refresh() after changing z_values directly.
+  static mesh_cell_t cells[GRID_MAX_POINTS_X - 1][GRID_MAX_POINTS_Y - 1];
+
   mesh_bed_leveling();
 
   static void report_mesh();
 
   static void reset();
 
+  static void refresh();
+  static void refresh_point(const int8_t px, const int8_t py);
+
   FORCE_INLINE static bool has_mesh() {
     GRID_LOOP(x, y) if (z_values[x][y]) return true;
     return false;
   }
 
-  static void set_z(const int8_t px, const int8_t py, const float &z) { z_values[px][py] = z; }
+  static void set_z(const int8_t px, const int8_t py, const float &z) { z_values[px][py] = z; refresh_point(px, py); }
 
   static inline void zigzag(const int8_t index, int8_t &px, int8_t &py) {
     px = index % (GRID_MAX_POINTS_X);
@@ -96,10 +110,19 @@ public:
   }
   static inline xy_int8_t probe_indexes(const xy_pos_t &xy) { return probe_indexes(xy.x, xy.y); }
 
-  static float calc_z0(const float &a0, const float &a1, const float &z1, const float &a2, const float &z2) {
-    const float delta_z = (z2 - z1) / (a2 - a1),
-                delta_a = a0 - a1;
-    return z1 + delta_a * delta_z;
+  // Interpolated mesh height at u,v mm from the origin of a cell (without z_offset)
+  static inline float cell_z(const xy_int8_t &ind, float u, float v) {
+    const mesh_cell_t &c = cells[ind.x][ind.y];
+    #if ENABLED(MBL_BICUBIC_INTERPOLATION)
+      // Cubic patches diverge quickly, so hold the edge value beyond the mesh
+      const float t = constrain(u * RECIPROCAL(MESH_X_DIST), 0, 1),
+                  s = constrain(v * RECIPROCAL(MESH_Y_DIST), 0, 1);
+      float r[4];
+      LOOP_L_N(m, 4) r[m] = ((c.c[m][3] * s + c.c[m][2]) * s + c.c[m][1]) * s + c.c[m][0];
+      return ((r[3] * t + r[2]) * t + r[1]) * t + r[0];
+    #else
+      return c.z0 + u * c.dx + v * (c.dy + u * c.dxy);
+    #endif
   }
 
   static float get_z(const xy_pos_t &pos
@@ -111,17 +134,35 @@ public:
       constexpr float factor = 1.0f;
     #endif
     const xy_int8_t ind = cell_indexes(pos);
-    const float x1 = index_to_xpos[ind.x], x2 = index_to_xpos[ind.x+1],
-                y1 = index_to_xpos[ind.y], y2 = index_to_xpos[ind.y+1],
-                z1 = calc_z0(pos.x, x1, z_values[ind.x][ind.y  ], x2, z_values[ind.x+1][ind.y  ]),
-                z2 = calc_z0(pos.x, x1, z_values[ind.x][ind.y+1], x2, z_values[ind.x+1][ind.y+1]);
-
-    return z_offset + calc_z0(pos.y, y1, z1, y2, z2) * factor;
+    return z_offset + cell_z(ind, pos.x - index_to_xpos[ind.x], pos.y - index_to_ypos[ind.y]) * factor;
   }
 
-  #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
-    static void line_to_destination(const feedRate_t &scaled_fr_mm_s, uint8_t x_splits=0xFF, uint8_t y_splits=0xFF);
-  #endif
+  /**
+   * Mesh height at evenly spaced points along a line, for segmenters.
+   *
+   * Inside one bilinear cell the height along a line is a quadratic in the
+   * step number, so each step costs two additions (forward differencing).
+   * The differences are re-derived only when the line enters another cell.
+   */
+  class line_evaluator {
+    xy_pos_t pos, step;
+    xy_int8_t cell;
+    uint16_t steps_in_cell;
+    float z, d1, d2;
+    void enter_cell();
+  public:
+    // Begin at 'start', advancing by 'delta' on each call to next()
+    void begin(const xy_pos_t &start, const xy_pos_t &delta) { pos = start; step = delta; enter_cell(); }
+    // The height at the current point (without z_offset)
+    inline float value() const { return z; }
+    // Advance one step and return the height there (without z_offset)
+    inline float next() {
+      pos += step;
+      if (steps_in_cell) { steps_in_cell--; z += d1; d1 += d2; }
+      else enter_cell();
+      return z;
+    }
+  };
 };
 
 extern mesh_bed_leveling mbl;
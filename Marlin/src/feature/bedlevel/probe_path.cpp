@@ -0,0 +1,184 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(OPTIMIZE_PROBE_PATH)
+
+#include "probe_path.h"
+
+ProbePath probe_path;
+
+uint8_t ProbePath::count;
+float ProbePath::est_time, ProbePath::est_zigzag;
+xy_uint8_t ProbePath::points;
+xy_pos_t ProbePath::origin, ProbePath::spacing, ProbePath::start;
+uint8_t ProbePath::order[GRID_MAX_POINTS], ProbePath::slot[GRID_MAX_POINTS];
+
+#define UNPLANNED 0xFF  // slot[] of a point not yet in the path
+#define EXCLUDED  0xFE  // slot[] of a point left out by the filter
+
+#define TWO_OPT_PASSES 4
+
+// Time to raise the probe after a point and lower it again at the next
+static constexpr float raise_time = 2.0f * (Z_CLEARANCE_BETWEEN_PROBES) / MMM_TO_MMS(Z_PROBE_SPEED_FAST),
+                       near_raise_time = 2.0f * (PROBE_PATH_NEAR_CLEARANCE) / MMM_TO_MMS(Z_PROBE_SPEED_FAST);
+
+bool ProbePath::adjacent(const uint8_t a, const uint8_t b) {
+  const xy_uint8_t ia = index(a), ib = index(b);
+  return ABS(int16_t(ia.x) - int16_t(ib.x)) <= 1 && ABS(int16_t(ia.y) - int16_t(ib.y)) <= 1;
+}
+
+float ProbePath::cost(const uint8_t a, const uint8_t b) {
+  return (position(b) - position(a)).magnitude() / (XY_PROBE_FEEDRATE_MM_S)
+       + (adjacent(a, b) ? near_raise_time : raise_time);
+}
+
+// Reverse order[i..k], keeping slot[] in step
+void ProbePath::reverse(uint8_t i, uint8_t k) {
+  for (; i < k; i++, k--) {
+    const uint8_t t = order[i];
+    order[i] = order[k]; order[k] = t;
+    slot[order[i]] = i; slot[order[k]] = k;
+  }
+}
+
+uint8_t ProbePath::plan(const xy_pos_t &start_pos, const xy_uint8_t &grid_points, const xy_pos_t &grid_origin, const xy_pos_t &grid_spacing, const probe_path_filter_t filter/*=nullptr*/) {
+  points = grid_points;
+  origin = grid_origin;
+  spacing = grid_spacing;
+  start = start_pos;
+  count = 0;
+
+  uint8_t total = 0;
+  for (uint8_t y = 0; y < points.y; y++)
+    for (uint8_t x = 0; x < points.x; x++) {
+      const uint8_t i = id(x, y);
+      const bool use = !filter || filter(index(i), position(i));
+      slot[i] = use ? UNPLANNED : EXCLUDED;
+      if (use) total++;
+    }
+
+  //
+  // Nearest neighbor, searching rings of cells around the last point
+  //
+  const float min_step = _MAX(_MIN(spacing.x, spacing.y), 0.001f);
+  xy_int_t cell = {
+    int16_t(constrain(LROUND((start.x - origin.x) / _MAX(spacing.x, 0.001f)), 0, points.x - 1)),
+    int16_t(constrain(LROUND((start.y - origin.y) / _MAX(spacing.y, 0.001f)), 0, points.y - 1))
+  };
+  const uint8_t max_ring = _MAX(points.x, points.y);
+
+  while (count < total) {
+    int16_t best = -1;
+    float best_cost = 0;
+    for (uint8_t r = 0; r <= max_ring; r++) {
+      // Ring r is at least r - 1 cells away, even from a start between cells
+      if (best >= 0 && r >= 2 && best_cost <= (r - 1) * min_step / (XY_PROBE_FEEDRATE_MM_S) + (count ? raise_time : 0))
+        break;
+      for (int16_t dy = -r; dy <= r; dy++) {
+        const int16_t y = cell.y + dy;
+        if (!WITHIN(y, 0, points.y - 1)) continue;
+        // Whole rows at the top and bottom of the ring, only the ends between
+        const int16_t dx_step = (dy == -r || dy == r) ? 1 : 2 * r;
+        for (int16_t dx = -r; dx <= r; dx += dx_step) {
+          const int16_t x = cell.x + dx;
+          if (!WITHIN(x, 0, points.x - 1)) continue;
+          const uint8_t i = id(x, y);
+          if (slot[i] != UNPLANNED) continue;
+          const float c = count ? cost(order[count - 1], i)
+                                : (position(i) - start).magnitude() / (XY_PROBE_FEEDRATE_MM_S);
+          if (best < 0 || c < best_cost) { best = i; best_cost = c; }
+        }
+      }
+    }
+    slot[best] = count;
+    order[count++] = best;
+    cell = index(best).asInt();
+  }
+
+  //
+  // 2-opt: Replace the edges (a,b) and (c,d) with (a,c) and (b,d) by reversing
+  // the run from b to c. A shorter path needs a short (a,c), so c is only
+  // taken from the grid neighbors of a. The first point stays the closest one
+  // to the start, and the far end of the path is open.
+  //
+  for (uint8_t pass = 0; pass < TWO_OPT_PASSES; pass++) {
+    bool improved = false;
+    for (uint8_t i = 1; i + 1 < count; i++) {
+      const uint8_t a = order[i - 1];
+      const xy_uint8_t ia = index(a);
+      for (int8_t ny = -1; ny <= 1; ny++) for (int8_t nx = -1; nx <= 1; nx++) {
+        const int16_t x = ia.x + nx, y = ia.y + ny;
+        if (!(nx || ny) || !WITHIN(x, 0, points.x - 1) || !WITHIN(y, 0, points.y - 1)) continue;
+        const uint8_t k = slot[id(x, y)];
+        if (k >= count || k <= i) continue;
+        const uint8_t b = order[i], c = order[k];
+        float delta = cost(a, c) - cost(a, b);
+        if (k + 1 < count) {
+          const uint8_t d = order[k + 1];
+          delta += cost(b, d) - cost(c, d);
+        }
+        if (delta < -0.001f) { reverse(i, k); improved = true; }
+      }
+    }
+    if (!improved) break;
+  }
+
+  est_time = path_time();
+  est_zigzag = zigzag_time();
+  return count;
+}
+
+float ProbePath::path_time() {
+  if (!count) return 0;
+  float t = (position(order[0]) - start).magnitude() / (XY_PROBE_FEEDRATE_MM_S);
+  for (uint8_t n = 1; n < count; n++) t += cost(order[n - 1], order[n]);
+  return t;
+}
+
+// The same points in the usual row-by-row zig-zag, raising fully every time
+float ProbePath::zigzag_time() {
+  float t = 0;
+  xy_pos_t last = start;
+  bool first = true;
+  for (uint8_t y = 0; y < points.y; y++)
+    for (uint8_t n = 0; n < points.x; n++) {
+      const uint8_t i = id((y & 1) ? points.x - 1 - n : n, y);
+      if (slot[i] == EXCLUDED) continue;
+      const xy_pos_t pos = position(i);
+      t += (pos - last).magnitude() / (XY_PROBE_FEEDRATE_MM_S);
+      if (!first) t += raise_time;
+      first = false;
+      last = pos;
+    }
+  return t;
+}
+
+void ProbePath::report() {
+  SERIAL_ECHOPAIR("Probe path: ", int(count), " points, est. ");
+  SERIAL_ECHO(int(LROUND(est_time)));
+  SERIAL_ECHOPAIR("s (zig-zag ", int(LROUND(est_zigzag)));
+  SERIAL_ECHOLNPAIR("s, saves ", int(LROUND(est_zigzag - est_time)), "s)");
+}
+
+#endif // OPTIMIZE_PROBE_PATH
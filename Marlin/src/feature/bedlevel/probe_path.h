@@ -0,0 +1,82 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * probe_path.h - Probing order for ABL and UBL grids
+ *
+ * The path is built in two steps:
+ *  - Nearest neighbor from the start position. The search walks rings of
+ *    grid cells outward from the last point and stops as soon as no farther
+ *    ring could hold a cheaper point, so on a mostly-full grid each step
+ *    only looks at the first ring.
+ *  - 2-opt repair of the crossings the greedy pass leaves behind, trying only
+ *    the moves that make two grid neighbors consecutive.
+ *
+ * The cost of a move is its travel time at XY_PROBE_FEEDRATE plus the time to
+ * raise and lower the probe, which is shorter between neighboring points.
+ */
+
+#include "../../module/probe.h"
+
+// Return false to leave a grid point out of the path
+typedef bool (*probe_path_filter_t)(const xy_uint8_t &ind, const xy_pos_t &pos);
+
+class ProbePath {
+public:
+  static uint8_t count;               // Number of points in the path
+  static float est_time, est_zigzag;  // Estimated seconds for the path and for a plain zig-zag
+
+  /**
+   * Plan a path over a grid of probe positions, origin + spacing * index.
+   * The start position is also in terms of the probe. Return the point count.
+   */
+  static uint8_t plan(const xy_pos_t &start, const xy_uint8_t &points, const xy_pos_t &origin, const xy_pos_t &spacing, const probe_path_filter_t filter=nullptr);
+
+  // Grid indexes of the n-th point in the path
+  static xy_uint8_t point(const uint8_t n) { return index(order[n]); }
+
+  // How far to raise after probing the n-th point
+  static ProbePtRaise raise_after(const uint8_t n) {
+    return n + 1 < count && adjacent(order[n], order[n + 1]) ? PROBE_PT_NEAR_RAISE : PROBE_PT_RAISE;
+  }
+
+  static void report();
+
+private:
+  static xy_uint8_t points;
+  static xy_pos_t origin, spacing, start;
+  static uint8_t order[GRID_MAX_POINTS],  // Cell ids in probing order
+                 slot[GRID_MAX_POINTS];   // Position of each cell id in order[]
+
+  static inline uint8_t id(const uint8_t x, const uint8_t y) { return x + y * points.x; }
+  static inline xy_uint8_t index(const uint8_t id) { return { uint8_t(id % points.x), uint8_t(id / points.x) }; }
+  static inline xy_pos_t position(const uint8_t id) { return origin + spacing * index(id).asFloat(); }
+
+  static bool adjacent(const uint8_t a, const uint8_t b);
+  static float cost(const uint8_t a, const uint8_t b);
+  static float path_time();
+  static float zigzag_time();
+  static void reverse(uint8_t i, uint8_t k);
+};
+
+extern ProbePath probe_path;
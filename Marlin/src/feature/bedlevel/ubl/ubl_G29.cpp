@@ -49,6 +49,10 @@
     #include "../../../lcd/extui/ui_api.h"
   #endif
 
+  #if ENABLED(OPTIMIZE_PROBE_PATH)
+    #include "../probe_path.h"
+  #endif
+
   #include <math.h>
 
   #define UBL_G29_P31
@@ -747,7 +751,23 @@
       #endif
 
       save_ubl_active_state_and_disable();  // No bed level correction so only raw data is obtained
-      uint8_t count = GRID_MAX_POINTS;
+      uint8_t count = GRID_MAX_POINTS, probed = 0;
+      const millis_t probe_start = millis();
+
+      #if ENABLED(PIPELINED_PROBING)
+        REMEMBER(pipe, probe.pipelined, true);
+        probe.expected_z = NAN;
+      #endif
+
+      #if ENABLED(OPTIMIZE_PROBE_PATH)
+        // Plan the whole order up front, over the invalid points the probe can reach
+        if (!do_furthest) {
+          probe_path.plan(near, { GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y }, { MESH_MIN_X, MESH_MIN_Y }, { MESH_X_DIST, MESH_Y_DIST },
+            [](const xy_uint8_t &ind, const xy_pos_t &pos) { return isnan(z_values[ind.x][ind.y]) && probe.can_reach(pos); }
+          );
+          probe_path.report();
+        }
+      #endif
 
       mesh_index_pair best;
       do {
@@ -771,16 +791,44 @@
           }
         #endif
 
+        ProbePtRaise raise_after = stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE;
+
+        #if ENABLED(OPTIMIZE_PROBE_PATH)
+          if (!do_furthest) {
+            const uint8_t n = (GRID_MAX_POINTS) - count;
+            if (n < probe_path.count) {
+              const xy_uint8_t ind = probe_path.point(n);
+              best.pos.set(ind.x, ind.y);
+              if (!stow_probe) raise_after = probe_path.raise_after(n);
+            }
+            else
+              best.invalidate();
+          }
+          else
+        #endif
         best = do_furthest
           ? find_furthest_invalid_mesh_point()
           : find_closest_mesh_point_of_type(INVALID, near, true);
 
         if (best.pos.x >= 0) {    // mesh point found and is reachable by probe
-          const float measured_z = probe.probe_at_point(
-                        best.meshpos(),
-                        stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE, g29_verbose_level
-                      );
+          #if ENABLED(PIPELINED_PROBING)
+            // Expect the bed at the mean of the probed neighbors
+            if (!isnan(probe.expected_z)) {
+              float z_sum = 0;
+              uint8_t z_count = 0;
+              LOOP_L_N(i, 4) {
+                const int8_t x = best.pos.x + (i == 0) - (i == 1), y = best.pos.y + (i == 2) - (i == 3);
+                if (WITHIN(x, 0, GRID_MAX_POINTS_X - 1) && WITHIN(y, 0, GRID_MAX_POINTS_Y - 1) && !isnan(z_values[x][y])) {
+                  z_sum += z_values[x][y];
+                  z_count++;
+                }
+              }
+              if (z_count) probe.expected_z = z_sum / z_count;
+            }
+          #endif
+          const float measured_z = probe.probe_at_point(best.meshpos(), raise_after, g29_verbose_level);
           z_values[best.pos.x][best.pos.y] = measured_z;
+          probed++;
           #if ENABLED(EXTENSIBLE_UI)
             ExtUI::onMeshUpdate(best.pos, measured_z);
           #endif
@@ -801,6 +849,8 @@
         probe.move_z_after_probing();
       #endif
 
+      if (probed) SERIAL_ECHOLNPAIR("Probed ", int(probed), " points, ", (millis() - probe_start) / probed, " ms per point.");
+
       restore_ubl_active_state_and_leave();
 
       do_blocking_move_to_xy(
@@ -366,21 +366,28 @@
 
     xyze_pos_t raw = current_position;
 
+    // Segments are handed to the planner in batches
+    xyze_pos_t batch[SEGMENT_BATCH_SIZE];
+    uint8_t count = 0;
+    auto flush_batch = [&]() {
+      const bool ok = planner.buffer_segments(batch, count, scaled_fr_mm_s, active_extruder, segment_xyz_mm
+        #if ENABLED(SCARA_FEEDRATE_SCALING)
+          , inv_duration
+        #endif
+      ) == count;
+      count = 0;
+      return ok;
+    };
+
     // Just do plain segmentation if UBL is inactive or the target is above the fade height
     if (!planner.leveling_active || !planner.leveling_active_at_z(destination.z)) {
       while (--segments) {
         raw += diff;
-        planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, segment_xyz_mm
-          #if ENABLED(SCARA_FEEDRATE_SCALING)
-            , inv_duration
-          #endif
-        );
+        batch[count++] = raw;
+        if (count == SEGMENT_BATCH_SIZE && !flush_batch()) return false;
       }
-      planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, segment_xyz_mm
-        #if ENABLED(SCARA_FEEDRATE_SCALING)
-          , inv_duration
-        #endif
-      );
+      batch[count++] = destination;
+      flush_batch();
       return false; // Did not set current from destination
     }
 
@@ -451,14 +458,15 @@
           #endif
         ;
 
-        planner.buffer_line(raw.x, raw.y, raw.z + z_cxcy, raw.e, scaled_fr_mm_s, active_extruder, segment_xyz_mm
-          #if ENABLED(SCARA_FEEDRATE_SCALING)
-            , inv_duration
-          #endif
-        );
+        batch[count] = raw;
+        batch[count++].z += z_cxcy;
 
-        if (segments == 0)                        // done with last segment
+        if (segments == 0) {                      // done with last segment
+          flush_batch();
           return false;                           // didn't set current from destination
+        }
+
+        if (count == SEGMENT_BATCH_SIZE && !flush_batch()) return false;
 
         raw += diff;
         cell += diff;
@@ -34,6 +34,10 @@ int8_t CancelObject::object_count, // = 0
 uint32_t CancelObject::canceled; // = 0x0000
 bool CancelObject::skipping; // = false
 
+int8_t CancelObject::read_object = -1;
+bool CancelObject::dropped; // = false
+char CancelObject::dropped_z[12], CancelObject::dropped_e[12], CancelObject::dropped_f[12];
+
 void CancelObject::set_active_object(const int8_t obj) {
   active_object = obj;
   if (WITHIN(obj, 0, 31)) {
@@ -65,6 +69,82 @@ void CancelObject::uncancel_object(const int8_t obj) {
   }
 }
 
+// Keep the value of a parameter of a dropped move, as text
+static void keep_param(const char *p, const char code, char (&value)[12]) {
+  for (; *p; p++) if (*p == code) {
+    uint8_t i = 0;
+    for (p++; i < sizeof(value) - 1 && (NUMERIC_SIGNED(*p) || *p == '.'); p++) value[i++] = *p;
+    value[i] = '\0';
+    return;
+  }
+}
+
+// Add a kept parameter to a command, if there is room
+static void add_param(char * const cmd, const char code, char (&value)[12]) {
+  if (!value[0]) return;
+  const size_t len = strlen(cmd);
+  if (len + 2 + strlen(value) < MAX_CMD_SIZE) {
+    cmd[len] = ' ';
+    cmd[len + 1] = code;
+    strcpy(cmd + len + 2, value);
+  }
+  value[0] = '\0';
+}
+
+/**
+ * Check a line as it is read from the host or the SD card, before it is
+ * queued, and return true to drop it. The moves and dwells of a canceled
+ * object are dropped here, so they take no queue, parser or planner time.
+ * Other commands still go through. The last Z, E and F of the dropped moves
+ * are added to the M486 S that ends them, so the print carries on from
+ * where the object would have left off.
+ */
+bool CancelObject::skip_line(char * const cmd) {
+  const char *p = cmd;
+  while (*p == ' ') p++;
+  if (*p == 'N') do p++; while (NUMERIC(*p) || *p == ' ');  // Skip a line number
+
+  const char letter = *p;
+  if (letter != 'G' && letter != 'M') return false;
+  char *end;
+  const long code = strtol(p + 1, &end, 10);
+  p = end;
+
+  if (letter == 'M') {
+    if (code != 486) return false;
+
+    if (strchr(p, 'T')) reset_reader();
+
+    const char * const s = strchr(p, 'S');
+    if (s) {
+      read_object = atoi(s + 1);
+      if (dropped && !(WITHIN(read_object, 0, 31) && is_canceled(read_object))) {
+        char * const star = strchr(cmd, '*');
+        if (star) *star = '\0';  // The checksum was checked already
+        add_param(cmd, 'Z', dropped_z);
+        add_param(cmd, 'E', dropped_e);
+        add_param(cmd, 'F', dropped_f);
+        dropped = false;
+      }
+    }
+    return false;
+  }
+
+  // G92 sets E for the lines that follow
+  if (code == 92) {
+    if (strchr(p, 'E')) dropped_e[0] = '\0';
+    return false;
+  }
+
+  if (code > 5 || !(WITHIN(read_object, 0, 31) && is_canceled(read_object))) return false;
+
+  keep_param(p, 'Z', dropped_z);
+  keep_param(p, 'E', dropped_e);
+  keep_param(p, 'F', dropped_f);
+  dropped = true;
+  return true;
+}
+
 void CancelObject::report() {
   if (active_object >= 0) {
     SERIAL_ECHO_START();
@@ -35,7 +35,15 @@ public:
   static inline bool is_canceled(const int8_t obj) { return TEST(canceled, obj); }
   static inline void clear_active_object() { set_active_object(-1); }
   static inline void cancel_active_object() { cancel_object(active_object); }
-  static inline void reset() { canceled = 0x0000; object_count = 0; clear_active_object(); }
+  static inline void reset() { canceled = 0x0000; object_count = 0; clear_active_object(); reset_reader(); }
+
+  static bool skip_line(char * const cmd);
+
+private:
+  static int8_t read_object;                  // The object of the lines being read
+  static bool dropped;                        // Lines were dropped since the last M486 S
+  static char dropped_z[12], dropped_e[12], dropped_f[12];
+  static inline void reset_reader() { read_object = -1; dropped = false; dropped_z[0] = dropped_e[0] = dropped_f[0] = '\0'; }
 };
 
 extern CancelObject cancelable;
@@ -0,0 +1,399 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * file_analysis.cpp - Analyze the selected SD file in the background
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(SD_FILE_ANALYSIS)
+
+#include "file_analysis.h"
+#include "../sd/cardreader.h"
+#include "../module/planner.h"
+
+FileAnalysis file_analysis;
+
+SdFile FileAnalysis::file;
+file_analysis_entry_t FileAnalysis::cache[SD_FILE_ANALYSIS_CACHE];
+file_analysis_entry_t *FileAnalysis::current; // = nullptr
+uint32_t FileAnalysis::scanned;
+
+#define MIN_LAYER_CHANGE 0.05f
+
+// State of the machine as the file would leave it
+static struct {
+  xyze_pos_t position;
+  xyz_float_t unit;           // Direction of the last move
+  float feedrate,             // (mm/s) Last F
+        last_nominal_sqr,     // (mm/s)^2 Speed of the last move
+        exit_sqr,             // (mm/s)^2 Exit speed of the last move timed
+        seconds,              // Time of the moves timed so far
+        layer_z,
+        acceleration, travel_acceleration,
+        max_feedrate_xy, max_feedrate_z, max_feedrate_e,
+        junction;             // Junction deviation, or jerk
+  scan_move_t window[FILE_ANALYSIS_LOOKAHEAD];
+  uint8_t count,              // Moves in the window
+          next_profile;
+  bool stopped,               // No junction with the last move
+       relative_xyz, relative_e;
+  uint8_t e_mode;             // 0: follow G90/G91, 1: M82, 2: M83
+  uint8_t length;             // Characters in the line buffer
+  bool comment;
+  char buffer[MAX_CMD_SIZE];
+} scan;
+
+// Parse a parameter from a raw command line, after the command word
+static bool get_param(const char *p, const char code, float &value) {
+  for (; *p; p++) if (toupper(*p) == code) {
+    char *end;
+    value = strtod(p + 1, &end);
+    return end != p + 1;
+  }
+  return false;
+}
+
+/**
+ * Start on a newly selected file, unless its result is cached
+ */
+void FileAnalysis::begin(SdFile * const dir, const char * const fname) {
+  abort();
+  if (!file.open(dir, fname, O_READ)) return;
+
+  dir_t entry;
+  if (!file.dirEntry(&entry)) { file.close(); return; }
+  const uint32_t size = file.fileSize();
+
+  LOOP_L_N(i, SD_FILE_ANALYSIS_CACHE) {
+    file_analysis_entry_t &c = cache[i];
+    if (c.done && c.size == size && c.date == entry.lastWriteDate && c.time == entry.lastWriteTime && !strcmp(c.filename, fname)) {
+      current = &c;
+      file.close();
+      return;
+    }
+  }
+
+  // Reuse the entries in turn
+  static uint8_t next; // = 0
+  current = &cache[next];
+  if (++next >= SD_FILE_ANALYSIS_CACHE) next = 0;
+
+  strncpy(current->filename, fname, sizeof(current->filename) - 1);
+  current->filename[sizeof(current->filename) - 1] = '\0';
+  current->size = size;
+  current->date = entry.lastWriteDate;
+  current->time = entry.lastWriteTime;
+  current->done = false;
+
+  file_analysis_t &r = current->result;
+  r.filament = r.height = 0;
+  r.layers = 0;
+  r.min.set(99999, 99999);
+  r.max.set(-99999, -99999);
+
+  scanned = 0;
+  scan.position.reset();
+  scan.unit.reset();
+  scan.feedrate = MMM_TO_MMS(1500);
+  scan.last_nominal_sqr = scan.exit_sqr = scan.seconds = 0;
+  scan.layer_z = -1;
+  scan.acceleration = planner.settings.acceleration;
+  scan.travel_acceleration = planner.settings.travel_acceleration;
+  scan.max_feedrate_xy = PLANNER_XY_FEEDRATE();
+  scan.max_feedrate_z = planner.settings.max_feedrate_mm_s[Z_AXIS];
+  scan.max_feedrate_e = planner.settings.max_feedrate_mm_s[E_AXIS];
+  scan.junction = TERN(CLASSIC_JERK, planner.max_jerk.x, planner.junction_deviation_mm);
+  scan.count = scan.next_profile = 0;
+  scan.stopped = true;
+  scan.relative_xyz = scan.relative_e = false;
+  scan.e_mode = 0;
+  scan.length = 0;
+  scan.comment = false;
+}
+
+void FileAnalysis::abort() {
+  if (file.isOpen()) file.close();
+  if (current && !current->done) current->size = 0; // Never matches
+  current = nullptr;
+}
+
+/**
+ * Read and analyze the file for a while. Not while the planner is running
+ * low, so a print or a host stream never waits on it.
+ */
+void FileAnalysis::idle() {
+  if (!current || current->done) return;
+  if (!card.isMounted()) return abort();
+  if (planner.has_blocks_queued() && planner.movesplanned() < (BLOCK_BUFFER_SIZE) / 2) return;
+
+  const uint32_t start = micros();
+  do {
+    char buffer[64];
+    const int16_t n = file.read(buffer, sizeof(buffer));
+    if (n < 0) return abort();
+    if (n == 0) return finish();
+    feed(buffer, n);
+  } while (micros() - start < SD_FILE_ANALYSIS_SLICE_US);
+}
+
+uint8_t FileAnalysis::percent() {
+  if (!current) return 0;
+  if (current->done) return 100;
+  return current->size ? scanned / ((current->size + 99) / 100) : 0;
+}
+
+const file_analysis_t* FileAnalysis::result() {
+  return current && current->done ? &current->result : nullptr;
+}
+
+/**
+ * Split the text into lines without comments
+ */
+void FileAnalysis::feed(const char * const buffer, const uint16_t length) {
+  // Time so far at each step of the profile
+  scanned += length;
+  while (scan.next_profile < FILE_ANALYSIS_PROFILE && scanned >= (scan.next_profile + 1) * (current->size / (FILE_ANALYSIS_PROFILE)))
+    current->result.profile[scan.next_profile++] = scan.seconds;
+
+  LOOP_L_N(i, length) {
+    const char c = buffer[i];
+    if (c == '\n' || c == '\r') {
+      scan.buffer[scan.length] = '\0';
+      if (scan.length) line(scan.buffer);
+      scan.length = 0;
+      scan.comment = false;
+    }
+    else if (c == ';')
+      scan.comment = true;
+    else if (!scan.comment && scan.length < sizeof(scan.buffer) - 1)
+      scan.buffer[scan.length++] = c;
+  }
+}
+
+void FileAnalysis::finish() {
+  if (scan.length) { scan.buffer[scan.length] = '\0'; line(scan.buffer); scan.length = 0; }
+  if (file.isOpen()) file.close();
+  if (!current) return;
+
+  stop();
+
+  file_analysis_t &r = current->result;
+  r.seconds = LROUND(scan.seconds);
+  while (scan.next_profile < FILE_ANALYSIS_PROFILE) r.profile[scan.next_profile++] = r.seconds;
+  if (r.min.x > r.max.x) { r.min.reset(); r.max.reset(); }
+  current->done = true;
+}
+
+void FileAnalysis::line(const char *cmd) {
+  while (*cmd == ' ') cmd++;
+  if (toupper(*cmd) == 'N') {                 // Skip a line number
+    cmd++;
+    while (NUMERIC(*cmd) || *cmd == ' ') cmd++;
+  }
+
+  const char letter = toupper(*cmd);
+  char *end;
+  const int code = strtol(cmd + 1, &end, 10);
+  const char * const p = end;
+  float v;
+
+  if (letter == 'G') switch (code) {
+    case 0: case 1: case 2: case 3: {
+      xyze_pos_t target = scan.position;
+      LOOP_XYZ(i) if (get_param(p, axis_codes[i], v)) target[i] = scan.relative_xyz ? target[i] + v : v;
+      if (get_param(p, 'E', v)) target.e = scan.relative_e ? target.e + v : v;
+      if (get_param(p, 'F', v) && v > 0) scan.feedrate = MMM_TO_MMS(v);
+      move(target, code == 2, code == 3, p);
+    } break;
+    case 4:
+      stop();
+      if (get_param(p, 'P', v)) scan.seconds += v * 0.001f;
+      else if (get_param(p, 'S', v)) scan.seconds += v;
+      break;
+    case 28: stop(); scan.position.reset(); break;
+    case 90: case 91:
+      scan.relative_xyz = code == 91;
+      if (!scan.e_mode) scan.relative_e = scan.relative_xyz;
+      break;
+    case 92:
+      LOOP_XYZE(i) if (get_param(p, axis_codes[i], v)) scan.position[i] = v;
+      break;
+  }
+  else if (letter == 'M') switch (code) {
+    case 82: case 83:
+      scan.relative_e = code == 83;
+      scan.e_mode = scan.relative_e ? 2 : 1;
+      break;
+    case 204:
+      if (get_param(p, 'S', v)) scan.acceleration = scan.travel_acceleration = v;
+      if (get_param(p, 'P', v)) scan.acceleration = v;
+      if (get_param(p, 'T', v)) scan.travel_acceleration = v;
+      break;
+  }
+}
+
+/**
+ * Queue a move. Its length, speed and junction limit go into the lookahead
+ * window, which is planned like the planner's queue: the newest move ends
+ * at a stop, and entry speeds are limited by junctions and acceleration.
+ */
+void FileAnalysis::move(const xyze_pos_t &target, const bool arc_cw, const bool arc_ccw, const char * const params) {
+  const xyze_float_t d = target - scan.position;
+  float length;
+  if (arc_cw || arc_ccw) {
+    float i = 0, j = 0, sweep;
+    get_param(params, 'I', i);
+    get_param(params, 'J', j);
+    const float r = HYPOT(i, j);
+    if (r) {
+      const xy_pos_t c = { scan.position.x + i, scan.position.y + j };
+      sweep = ATAN2(target.y - c.y, target.x - c.x) - ATAN2(-j, -i);
+      if (arc_cw && sweep >= 0) sweep -= RADIANS(360);
+      if (arc_ccw && sweep <= 0) sweep += RADIANS(360);
+      length = HYPOT(r * ABS(sweep), d.z);
+    }
+    else                                      // R form, counted as a line
+      length = SQRT(sq(d.x) + sq(d.y) + sq(d.z));
+  }
+  else
+    length = SQRT(sq(d.x) + sq(d.y) + sq(d.z));
+
+  float speed = scan.feedrate;
+  const bool extrude = d.e > 0 && length > 0.0001f;
+  xyz_float_t unit{0};
+  if (length > 0.0001f) {
+    NOMORE(speed, d.x || d.y ? scan.max_feedrate_xy : scan.max_feedrate_z);
+    unit = xyz_float_t(d) * RECIPROCAL(length);
+  }
+  else if (d.e) {                             // Retract or prime
+    length = ABS(d.e);
+    NOMORE(speed, scan.max_feedrate_e);
+  }
+  else
+    return;
+
+  if (scan.count == FILE_ANALYSIS_LOOKAHEAD) plan(1);
+
+  scan_move_t &m = scan.window[scan.count++];
+  m.length = length;
+  m.accel = extrude ? scan.acceleration : scan.travel_acceleration;
+  m.nominal_sqr = sq(speed);
+
+  // Junction speed from the angle with the last move, as the planner does
+  float junction_sqr = 0;
+  if (!scan.stopped && unit != xyz_float_t({0}) && scan.unit != xyz_float_t({0})) {
+    #if DISABLED(CLASSIC_JERK)
+      float cos_theta = -(unit.x * scan.unit.x + unit.y * scan.unit.y + unit.z * scan.unit.z);
+      if (cos_theta < 0.999999f) {
+        NOLESS(cos_theta, -0.999999f);
+        const float sin_theta_d2 = SQRT(0.5f * (1.0f - cos_theta));
+        junction_sqr = m.accel * scan.junction * sin_theta_d2 / (1.0f - sin_theta_d2);
+      }
+    #else
+      junction_sqr = sq(scan.junction);
+    #endif
+  }
+  m.max_entry_sqr = _MIN(junction_sqr, m.nominal_sqr, scan.last_nominal_sqr);
+  m.entry_sqr = scan.count == 1 ? _MIN(m.max_entry_sqr, scan.exit_sqr) : m.max_entry_sqr;
+
+  scan.unit = unit;
+  scan.last_nominal_sqr = m.nominal_sqr;
+  scan.stopped = false;
+
+  if (extrude) {
+    file_analysis_t &r = current->result;
+    r.filament += d.e;
+    NOLESS(r.height, target.z);
+    if (target.z > scan.layer_z + MIN_LAYER_CHANGE) { scan.layer_z = target.z; r.layers++; }
+    NOMORE(r.min.x, _MIN(scan.position.x, target.x)); NOLESS(r.max.x, _MAX(scan.position.x, target.x));
+    NOMORE(r.min.y, _MIN(scan.position.y, target.y)); NOLESS(r.max.y, _MAX(scan.position.y, target.y));
+  }
+
+  scan.position = target;
+}
+
+// Time of a trapezoid from its entry to its exit speed
+static float trapezoid_seconds(const scan_move_t &m, const float exit_sqr) {
+  const float nominal = SQRT(m.nominal_sqr), entry = SQRT(m.entry_sqr), exit = SQRT(exit_sqr),
+              accelerate = (m.nominal_sqr - m.entry_sqr) / (2 * m.accel),
+              decelerate = (m.nominal_sqr - exit_sqr) / (2 * m.accel);
+  if (accelerate + decelerate <= m.length)
+    return (nominal - entry) / m.accel + (nominal - exit) / m.accel + (m.length - accelerate - decelerate) / nominal;
+  // No cruise. Accelerate until meeting the deceleration.
+  const float peak = SQRT(m.accel * m.length + 0.5f * (m.entry_sqr + exit_sqr));
+  return (peak - entry) / m.accel + (peak - exit) / m.accel;
+}
+
+/**
+ * Plan the window, then time and drop the oldest moves. The entry of the
+ * oldest move was fixed when the move before it was dropped.
+ */
+void FileAnalysis::plan(const uint8_t count) {
+  if (!scan.count) return;
+
+  // Reverse pass: every move can slow down for the next, and the newest can stop
+  float next_sqr = 0;
+  for (uint8_t i = scan.count; --i;) {
+    scan_move_t &m = scan.window[i];
+    m.entry_sqr = _MIN(m.max_entry_sqr, next_sqr + 2 * m.accel * m.length);
+    next_sqr = m.entry_sqr;
+  }
+  // Forward pass: no move enters faster than the one before can reach
+  LOOP_L_N(i, scan.count - 1U) {
+    const scan_move_t &m = scan.window[i];
+    NOMORE(scan.window[i + 1].entry_sqr, m.entry_sqr + 2 * m.accel * m.length);
+  }
+
+  const uint8_t n = _MIN(count, scan.count);
+  LOOP_L_N(i, n) {
+    scan.exit_sqr = i + 1U < scan.count ? scan.window[i + 1].entry_sqr : 0;
+    scan.seconds += trapezoid_seconds(scan.window[i], scan.exit_sqr);
+  }
+  scan.count -= n;
+  memmove(scan.window, scan.window + n, scan.count * sizeof(scan_move_t));
+}
+
+// Finish the queued moves and come to a stop
+void FileAnalysis::stop() {
+  plan(scan.count);
+  scan.exit_sqr = 0;
+  scan.stopped = true;
+}
+
+/**
+ * Time left to print the analyzed file: the blocks in the planner, plus
+ * the part of the file not read yet, from the profile of the analysis.
+ */
+uint32_t FileAnalysis::remaining_seconds() {
+  const file_analysis_t * const r = result();
+  if (!r || !card.isFileOpen() || !current->size) return 0;
+
+  const float f = float(card.getIndex()) * (FILE_ANALYSIS_PROFILE) / current->size;
+  const uint8_t i = _MIN(uint8_t(f), FILE_ANALYSIS_PROFILE - 1);
+  const float before = i ? r->profile[i - 1] : 0,
+              done = before + (r->profile[i] - before) * (f - i);
+  return LROUND(planner.get_queued_seconds() + _MAX(0, r->seconds - done));
+}
+
+#endif // SD_FILE_ANALYSIS
@@ -0,0 +1,87 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * file_analysis.h - Analyze the selected SD file in the background
+ *
+ * When a file is selected it is read from idle() in short slices while the
+ * planner has blocks to spare. Moves are planned as the planner would, to
+ * estimate the print time, filament used, height, layer count and the
+ * extent of the print. Results are kept for the last few files, keyed by
+ * name, size and date.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../sd/SdFile.h"
+
+#define FILE_ANALYSIS_LOOKAHEAD 8   // Moves planned together, like the planner's queue
+#define FILE_ANALYSIS_PROFILE  16   // Steps of the time profile
+
+typedef struct {
+  float length, accel,
+        nominal_sqr, max_entry_sqr, entry_sqr;
+} scan_move_t;
+
+typedef struct {
+  uint32_t seconds;           // Estimated print time
+  uint32_t profile[FILE_ANALYSIS_PROFILE]; // Estimated time at the end of each 1/16 of the file
+  float filament,             // Filament extruded, in mm
+        height;               // Highest extrusion
+  uint16_t layers;
+  xy_pos_t min, max;          // Extent of the extrusions
+} file_analysis_t;
+
+typedef struct {
+  char filename[FILENAME_LENGTH];
+  uint32_t size;
+  uint16_t date, time;
+  bool done;
+  file_analysis_t result;
+} file_analysis_entry_t;
+
+class FileAnalysis {
+  public:
+    static void begin(SdFile * const dir, const char * const fname);
+    static void abort();
+    static void idle();
+
+    static uint8_t percent();                       // Progress of the selected file
+    static const file_analysis_t* result();         // nullptr until the selected file is done
+    static uint32_t remaining_seconds();            // Estimated time left to print the selected file
+
+    static void feed(const char * const buffer, const uint16_t length);
+    static void finish();
+
+  private:
+    static SdFile file;
+    static file_analysis_entry_t cache[SD_FILE_ANALYSIS_CACHE];
+    static file_analysis_entry_t *current;
+    static uint32_t scanned;
+
+    static void line(const char *cmd);
+    static void move(const xyze_pos_t &target, const bool arc_cw, const bool arc_ccw, const char * const params);
+    static void plan(const uint8_t count);
+    static void stop();
+};
+
+extern FileAnalysis file_analysis;
@@ -0,0 +1,250 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * layer_index.cpp - Index the layers of an SD print for seeking
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(SD_LAYER_INDEX)
+
+#include "layer_index.h"
+#include "../gcode/gcode.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+
+LayerIndex layer_index;
+
+const char LayerIndex::filename[11] = "LAYERS.IDX";
+
+SdFile LayerIndex::file;
+bool LayerIndex::building, LayerIndex::relative_xyz, LayerIndex::has_z_move;
+uint8_t LayerIndex::e_mode, LayerIndex::tool;
+float LayerIndex::current_z, LayerIndex::layer_z;
+layer_index_entry_t LayerIndex::state, LayerIndex::z_move;
+
+#ifndef SD_LAYER_INDEX_MIN_Z_CHANGE
+  #define SD_LAYER_INDEX_MIN_Z_CHANGE 0.05
+#endif
+
+enum : uint8_t { E_MODE_FOLLOW, E_MODE_ABSOLUTE, E_MODE_RELATIVE };
+
+// Parse a parameter from a raw command line, after the command word
+static bool get_param(const char *p, const char code, float &value) {
+  for (; *p; p++) if (toupper(*p) == code) {
+    char *end;
+    value = strtod(p + 1, &end);
+    return end != p + 1;
+  }
+  return false;
+}
+
+/**
+ * Begin a new index for a print starting at the top of the file.
+ * The scan starts from the machine state, which the file then changes.
+ */
+void LayerIndex::start() {
+  finish();
+
+  layer_index_header_t header;
+  card.getAbsFilename(header.sd_filename);
+  header.filesize = card.getFileSize();
+  if (!card.openLayerIndexFile(true)) return;
+  if (file.write(&header, sizeof(header)) != int16_t(sizeof(header)) || !file.sync()) {
+    file.close();
+    return;
+  }
+
+  state.sdpos = 0;
+  state.line = 1;
+  state.z = 0;
+  state.e = current_position.e;
+  state.feedrate = MMS_TO_MMM(feedrate_mm_s);
+  #if HOTENDS
+    HOTEND_LOOP() state.target_temperature[e] = thermalManager.degTargetHotend(e);
+  #endif
+  #if HAS_HEATED_BED
+    state.target_temperature_bed = thermalManager.degTargetBed();
+  #endif
+  #if FAN_COUNT
+    COPY(state.fan_speed, thermalManager.fan_speed);
+  #endif
+  relative_xyz = gcode.axis_is_relative(X_AXIS);
+  e_mode = TEST(gcode.axis_relative, E_MODE_REL) ? E_MODE_RELATIVE : TEST(gcode.axis_relative, E_MODE_ABS) ? E_MODE_ABSOLUTE : E_MODE_FOLLOW;
+  state.relative_e = gcode.axis_is_relative(E_AXIS);
+  tool = active_extruder;
+  current_z = current_position.z;
+  layer_z = -1;
+  has_z_move = false;
+  building = true;
+}
+
+void LayerIndex::finish() {
+  building = false;
+  if (file.isOpen()) file.close();
+}
+
+/**
+ * Scan a line read from the print file. Called at the end of every line,
+ * with the command stripped of comments. Only the commands that change the
+ * state kept in the index are looked at.
+ */
+void LayerIndex::scan(const char * const cmd, const bool line_end) {
+  if (!building || card.inSubcall()) return;
+
+  const char *p = cmd;
+  while (*p == ' ') p++;
+  if (toupper(*p) == 'N') {                 // Skip a line number
+    p++;
+    while (NUMERIC(*p) || *p == ' ') p++;
+  }
+
+  const char letter = toupper(*p);
+  char *end;
+  const int code = strtol(p + 1, &end, 10);
+  p = end;
+  float v;
+
+  if (letter == 'G') switch (code) {
+    case 0: case 1: {
+      // Keep the state before the Z move that leads to a layer
+      if (get_param(p, 'Z', v)) {
+        const float z = relative_xyz ? current_z + v : v;
+        if (z != current_z) { z_move = state; has_z_move = true; }
+        current_z = z;
+      }
+
+      bool extrude = false;
+      if (get_param(p, 'E', v)) {
+        const float e = state.relative_e ? state.e + v : v;
+        extrude = e > state.e;
+        state.e = e;
+      }
+      if (get_param(p, 'F', v)) state.feedrate = v;
+
+      // The first extrusion above the last layer starts a new one
+      if (extrude && current_z > layer_z + (SD_LAYER_INDEX_MIN_Z_CHANGE)) {
+        if (!has_z_move) z_move = state;
+        z_move.z = layer_z = current_z;
+        has_z_move = false;
+        if (file.write(&z_move, sizeof(z_move)) != int16_t(sizeof(z_move)) || !file.sync())
+          finish();
+      }
+    } break;
+    case 90: case 91:
+      relative_xyz = code == 91;
+      if (e_mode == E_MODE_FOLLOW) state.relative_e = relative_xyz;
+      break;
+    case 92: if (get_param(p, 'E', v)) state.e = v; break;
+  }
+  else if (letter == 'M') switch (code) {
+    case 82: case 83:
+      state.relative_e = code == 83;
+      e_mode = state.relative_e ? E_MODE_RELATIVE : E_MODE_ABSOLUTE;
+      break;
+    #if HOTENDS
+      case 104: case 109:
+        if (get_param(p, 'S', v) || get_param(p, 'R', v)) {
+          float t;
+          const uint8_t e = get_param(p, 'T', t) ? uint8_t(t) : tool;
+          if (e < HOTENDS) state.target_temperature[e] = v;
+        }
+        break;
+    #endif
+    #if HAS_HEATED_BED
+      case 140: case 190:
+        if (get_param(p, 'S', v) || get_param(p, 'R', v)) state.target_temperature_bed = v;
+        break;
+    #endif
+    #if FAN_COUNT
+      case 106: case 107: {
+        float f;
+        const uint8_t i = get_param(p, 'P', f) ? uint8_t(f) : 0;
+        if (i < FAN_COUNT) state.fan_speed[i] = code == 107 ? 0 : get_param(p, 'S', v) ? constrain(v, 0, 255) : 255;
+      } break;
+    #endif
+  }
+  else if (letter == 'T')
+    tool = code;
+
+  // The next line starts here
+  state.sdpos = card.getIndex();
+  if (line_end) state.line++;
+}
+
+bool LayerIndex::read_header(layer_index_header_t &header) {
+  if (!card.openLayerIndexFile(false)) return false;
+  char sd_filename[MAXPATHNAMELENGTH];
+  card.getAbsFilename(sd_filename);
+  if (file.read(&header, sizeof(header)) == int16_t(sizeof(header))
+    && header.filesize == card.getFileSize()
+    && strcmp(header.sd_filename, sd_filename) == 0
+  ) return true;
+  file.close();
+  return false;
+}
+
+/**
+ * Find a layer of the open print file, by number or by height.
+ * With a height, find the first layer at or above it.
+ */
+bool LayerIndex::find(layer_index_entry_t &entry, uint16_t &layer, const float z/*=NAN*/) {
+  if (building || !card.isFileOpen()) return false;
+
+  layer_index_header_t header;
+  if (!read_header(header)) return false;
+
+  bool found = false;
+  if (isnan(z))
+    found = file.seekSet(sizeof(header) + uint32_t(layer) * sizeof(entry)) && file.read(&entry, sizeof(entry)) == int16_t(sizeof(entry));
+  else
+    for (layer = 0; file.read(&entry, sizeof(entry)) == int16_t(sizeof(entry)); layer++)
+      if (entry.z >= z - 0.001f) { found = true; break; }
+
+  file.close();
+  return found;
+}
+
+/**
+ * Restore the state before the layer and seek the print file to it.
+ * The next line moves to the layer height.
+ */
+void LayerIndex::apply(const layer_index_entry_t &entry) {
+  #if HOTENDS
+    HOTEND_LOOP() thermalManager.setTargetHotend(entry.target_temperature[e], e);
+  #endif
+  #if HAS_HEATED_BED
+    thermalManager.setTargetBed(entry.target_temperature_bed);
+  #endif
+  #if FAN_COUNT
+    FANS_LOOP(i) thermalManager.set_fan_speed(i, entry.fan_speed[i]);
+  #endif
+  if (entry.relative_e) gcode.set_e_relative(); else gcode.set_e_absolute();
+  current_position.e = entry.e;
+  planner.set_e_position_mm(entry.e);
+  feedrate_mm_s = MMM_TO_MMS(entry.feedrate);
+  card.setIndex(entry.sdpos);
+}
+
+#endif // SD_LAYER_INDEX
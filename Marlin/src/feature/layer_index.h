@@ -0,0 +1,82 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * layer_index.h - Index the layers of an SD print for seeking
+ *
+ * Lines read from the SD file are scanned as they are queued. When the
+ * first extrusion at a new height is seen, the position of the Z move
+ * leading to it is appended to the index file, along with the modal
+ * state that applied before that move. Seeking to a layer is then one
+ * read of the index and a setIndex() on the print file.
+ */
+
+#include "../sd/cardreader.h"
+#include "../inc/MarlinConfig.h"
+
+typedef struct {
+  uint32_t sdpos,               // Start of the line that moves to the layer
+           line;                // Number of that line, from 1
+  float z,                      // Height of the layer
+        e,                      // E position before the line
+        feedrate;               // Last F, in mm/min
+  #if HOTENDS
+    int16_t target_temperature[HOTENDS];
+  #endif
+  #if HAS_HEATED_BED
+    int16_t target_temperature_bed;
+  #endif
+  #if FAN_COUNT
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+  bool relative_e;
+} layer_index_entry_t;
+
+typedef struct {
+  char sd_filename[MAXPATHNAMELENGTH];
+  uint32_t filesize;
+} layer_index_header_t;
+
+class LayerIndex {
+  public:
+    static const char filename[11];
+
+    static SdFile file;
+
+    static void start();
+    static void finish();
+    static void scan(const char * const cmd, const bool line_end);
+
+    static bool find(layer_index_entry_t &entry, uint16_t &layer, const float z=NAN);
+    static void apply(const layer_index_entry_t &entry);
+
+  private:
+    static bool building, relative_xyz, has_z_move;
+    static uint8_t e_mode, tool;
+    static float current_z, layer_z;
+    static layer_index_entry_t state,   // Modal state before the current line
+                               z_move;  // State before the last Z move
+    static bool read_header(layer_index_header_t &header);
+};
+
+extern LayerIndex layer_index;
@@ -36,6 +36,7 @@ bool PrintJobRecovery::enabled; // Initialized by settings.load()
 SdFile PrintJobRecovery::file;
 job_recovery_info_t PrintJobRecovery::info;
 const char PrintJobRecovery::filename[5] = "/PLR";
+uint32_t PrintJobRecovery::sequence; // = 0
 uint8_t PrintJobRecovery::queue_index_r;
 uint32_t PrintJobRecovery::cmd_sdpos, // = 0
          PrintJobRecovery::sdpos[BUFSIZE];
@@ -49,6 +50,7 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
 #include "../module/printcounter.h"
 #include "../module/temperature.h"
 #include "../core/serial.h"
+#include "../libs/crc16.h"
 
 #if ENABLED(FWRETRACT)
   #include "fwretract.h"
@@ -116,15 +118,44 @@ void PrintJobRecovery::purge() {
   card.removeJobRecoveryFile();
 }
 
+static uint16_t record_crc(const job_recovery_record_t &rec) {
+  uint16_t crc = 0;
+  crc16(&crc, &rec.sequence, sizeof(rec.sequence));
+  crc16(&crc, &rec.size, sizeof(rec.size));
+  crc16(&crc, &rec.info, sizeof(rec.info));
+  return crc;
+}
+
 /**
- * Load the recovery data, if it exists
+ * Read the newest valid record of the recovery file into rec and carry on
+ * numbering after it. Return its slot, or -1 if there is none.
  */
-void PrintJobRecovery::load() {
-  if (exists()) {
-    open(true);
-    (void)file.read(&info, sizeof(info));
-    close();
+int8_t PrintJobRecovery::read_newest(job_recovery_record_t &rec) {
+  if (!exists()) return -1;
+  open(true);
+  int8_t newest = -1;
+  uint32_t newest_seq = 0;
+  LOOP_L_N(slot, POWER_LOSS_SLOTS) {
+    if (!file.seekSet(slot * 512UL) || file.read(&rec, sizeof(rec)) != int16_t(sizeof(rec))) break;
+    if (rec.size == sizeof(rec.info) && rec.crc == record_crc(rec) && (newest < 0 || int32_t(rec.sequence - newest_seq) > 0)) {
+      newest = slot;
+      newest_seq = rec.sequence;
+    }
   }
+  if (newest >= 0 && newest != POWER_LOSS_SLOTS - 1 && (!file.seekSet(newest * 512UL) || file.read(&rec, sizeof(rec)) != int16_t(sizeof(rec))))
+    newest = -1;
+  close();
+  if (newest >= 0 && int32_t(newest_seq - sequence) > 0) sequence = newest_seq;
+  return newest;
+}
+
+/**
+ * Load the newest valid record, if the file exists
+ */
+void PrintJobRecovery::load() {
+  init();
+  job_recovery_record_t rec;
+  if (read_newest(rec) >= 0) info = rec.info;
   debug(PSTR("Load"));
 }
 
@@ -134,6 +165,12 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilename(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  // A reused file keeps its records, which may be newer than the
+  // current sequence. The next record must replace the newest of them.
+  if (card.prepareJobRecoveryFile()) {
+    job_recovery_record_t rec;
+    (void)read_newest(rec);
+  }
 }
 
 /**
@@ -267,17 +304,31 @@ void PrintJobRecovery::save(const bool force/*=false*/) {
 #endif
 
 /**
- * Save the recovery info the recovery file
+ * Save the recovery info to the older slot of the recovery file.
+ * This costs one SD block write and no FAT or directory updates,
+ * so it's also fast enough for the power-loss handler.
  */
 void PrintJobRecovery::write() {
 
   debug(PSTR("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  if (!card.jobRecoveryBlock && !card.prepareJobRecoveryFile()) {
+    DEBUG_ECHOLNPGM("Power-loss file open failed.");
+    return;
+  }
+
+  // Build the record in its own block buffer, leaving the SD block cache to the print file
+  job_recovery_record_t * const rec = (job_recovery_record_t*)card.jobRecoveryBuffer();
+  rec->sequence = ++sequence;
+  rec->size = sizeof(info);
+  rec->info = info;
+  CRITICAL_SECTION_START();
+  rec->info.sdpos = info.sdpos; // Set by the Stepper ISR
+  CRITICAL_SECTION_END();
+  rec->crc = record_crc(*rec);
+
+  if (!card.writeJobRecoveryBlock(sequence % POWER_LOSS_SLOTS, (uint8_t*)rec))
+    DEBUG_ECHOLNPGM("Power-loss file write failed.");
 }
 
 /**
@@ -112,6 +112,22 @@ typedef struct {
 
 } job_recovery_info_t;
 
+/**
+ * The recovery file holds two records, one per SD block, written in turn
+ * straight to the card. The valid record with the higher sequence number
+ * is the latest. A save cut short only damages the record being written.
+ */
+#define POWER_LOSS_SLOTS 2
+
+typedef struct {
+  uint32_t sequence;          // Higher is newer
+  uint16_t size;              // sizeof(job_recovery_info_t)
+  uint16_t crc;               // Checksum of sequence, size and info
+  job_recovery_info_t info;
+} job_recovery_record_t;
+
+static_assert(sizeof(job_recovery_record_t) <= 512, "job_recovery_info_t must fit in one SD block.");
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -119,6 +135,7 @@ class PrintJobRecovery {
     static SdFile file;
     static job_recovery_info_t info;
 
+    static uint32_t sequence;         //!< Sequence number of the last record
     static uint8_t queue_index_r;     //!< Queue index of the active command
     static uint32_t cmd_sdpos,        //!< SD position of the next command
                     sdpos[BUFSIZE];   //!< SD positions of queued commands
@@ -178,6 +195,7 @@ class PrintJobRecovery {
 
   private:
     static void write();
+    static int8_t read_newest(job_recovery_record_t &rec);
 
   #if ENABLED(BACKUP_POWER_SUPPLY)
     static void raise_z();
@@ -77,6 +77,9 @@ void GcodeSuite::M420() {
           ExtUI::onMeshUpdate(x, y, Z_VALUES(x, y));
         #endif
       }
+      #if ENABLED(MESH_BED_LEVELING)
+        mbl.refresh();
+      #endif
       SERIAL_ECHOPGM("Simulated " STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh ");
       SERIAL_ECHOPAIR(" (", x_min);
       SERIAL_CHAR(','); SERIAL_ECHO(y_min);
@@ -188,6 +191,8 @@ void GcodeSuite::M420() {
               }
             #if ENABLED(ABL_BILINEAR_SUBDIVISION)
               bed_level_virt_interpolate();
+            #elif ENABLED(MESH_BED_LEVELING)
+              mbl.refresh();
             #endif
           }
 
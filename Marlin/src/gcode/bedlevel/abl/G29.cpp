@@ -60,6 +60,10 @@
   #include "../../../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(OPTIMIZE_PROBE_PATH)
+  #include "../../../feature/bedlevel/probe_path.h"
+#endif
+
 #if HOTENDS > 1
   #include "../../../module/tool_change.h"
 #endif
@@ -654,11 +658,43 @@ G29_TYPE GcodeSuite::G29() {
 
     #if ABL_GRID
 
-      bool zig = PR_OUTER_END & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
-
       measured_z = 0;
 
       xy_int8_t meshCount;
+      uint8_t probed = 0;
+      const millis_t probe_start = millis();
+
+      #if ENABLED(PIPELINED_PROBING)
+        REMEMBER(pipe, probe.pipelined, true);
+        probe.expected_z = NAN;
+      #endif
+
+      #if ENABLED(OPTIMIZE_PROBE_PATH)
+
+        probe_path.plan(current_position + probe.offset_xy, abl_grid_points, probe_position_lf, gridSpacing,
+          #if IS_KINEMATIC
+            // Avoid probing outside the round or hexagonal area
+            [](const xy_uint8_t&, const xy_pos_t &pos) { return probe.can_reach(pos); }
+          #else
+            nullptr
+          #endif
+        );
+        if (verbose_level) probe_path.report();
+
+        const uint8_t pt_total = probe_path.count;
+
+        for (uint8_t pt_index = 1; pt_index <= pt_total; pt_index++) {
+
+          const xy_uint8_t ind = probe_path.point(pt_index - 1);
+          meshCount.set(ind.x, ind.y);
+
+          const ProbePtRaise raise_next = raise_after == PROBE_PT_RAISE ? probe_path.raise_after(pt_index - 1) : raise_after;
+
+      #else
+
+      bool zig = PR_OUTER_END & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
+
+      constexpr uint8_t pt_total = GRID_MAX_POINTS;
 
       // Outer loop is X with PROBE_Y_FIRST enabled
       // Outer loop is Y with PROBE_Y_FIRST disabled
@@ -686,23 +722,27 @@ G29_TYPE GcodeSuite::G29() {
         // Inner loop is X with PROBE_Y_FIRST disabled
         for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
 
+          const ProbePtRaise raise_next = raise_after;
+
+      #endif
+
           probePos = probe_position_lf + gridSpacing * meshCount.asFloat();
 
           #if ENABLED(AUTO_BED_LEVELING_LINEAR)
             indexIntoAB[meshCount.x][meshCount.y] = ++abl_probe_index; // 0...
           #endif
 
-          #if IS_KINEMATIC
+          #if IS_KINEMATIC && DISABLED(OPTIMIZE_PROBE_PATH)
             // Avoid probing outside the round or hexagonal area
             if (!probe.can_reach(probePos)) continue;
           #endif
 
-          if (verbose_level) SERIAL_ECHOLNPAIR("Probing mesh point ", int(pt_index), "/", int(GRID_MAX_POINTS), ".");
+          if (verbose_level) SERIAL_ECHOLNPAIR("Probing mesh point ", int(pt_index), "/", int(pt_total), ".");
           #if HAS_DISPLAY
-            ui.status_printf_P(0, PSTR(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_MESH), int(pt_index), int(GRID_MAX_POINTS));
+            ui.status_printf_P(0, PSTR(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_MESH), int(pt_index), int(pt_total));
           #endif
 
-          measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(probePos, raise_after, verbose_level);
+          measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(probePos, raise_next, verbose_level);
 
           if (isnan(measured_z)) {
             set_bed_leveling_enabled(abl_should_enable);
@@ -737,10 +777,17 @@ G29_TYPE GcodeSuite::G29() {
           #endif
 
           abl_should_enable = false;
+          probed++;
           idle();
 
+      #if ENABLED(OPTIMIZE_PROBE_PATH)
+        } // path
+      #else
         } // inner
       } // outer
+      #endif
+
+      if (verbose_level && probed) SERIAL_ECHOLNPAIR("Probed ", int(probed), " points, ", (millis() - probe_start) / probed, " ms per point.");
 
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
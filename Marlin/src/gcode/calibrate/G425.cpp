@@ -101,12 +101,6 @@ struct measurements_t {
   #define TEMPORARY_BACKLASH_CORRECTION(value)
 #endif
 
-#if ENABLED(BACKLASH_GCODE) && defined(BACKLASH_SMOOTHING_MM)
-  #define TEMPORARY_BACKLASH_SMOOTHING(value) REMEMBER(tbsm, backlash.smoothing_mm, value)
-#else
-  #define TEMPORARY_BACKLASH_SMOOTHING(value)
-#endif
-
 inline void calibration_move() {
   do_blocking_move_to(current_position, MMM_TO_MMS(CALIBRATION_FEEDRATE_TRAVEL));
 }
@@ -445,7 +439,6 @@ inline void calibrate_backlash(measurements_t &m, const float uncertainty) {
   {
     // New scope for TEMPORARY_BACKLASH_CORRECTION
     TEMPORARY_BACKLASH_CORRECTION(all_off);
-    TEMPORARY_BACKLASH_SMOOTHING(0.0f);
 
     probe_sides(m, uncertainty);
 
@@ -477,7 +470,6 @@ inline void calibrate_backlash(measurements_t &m, const float uncertainty) {
     {
       // New scope for TEMPORARY_BACKLASH_CORRECTION
       TEMPORARY_BACKLASH_CORRECTION(all_on);
-      TEMPORARY_BACKLASH_SMOOTHING(0.0f);
       const xyz_float_t move = { AXIS_CAN_CALIBRATE(X) * 3, AXIS_CAN_CALIBRATE(Y) * 3, AXIS_CAN_CALIBRATE(Z) * 3 };
       current_position += move; calibration_move();
       current_position -= move; calibration_move();
@@ -504,7 +496,6 @@ inline void update_measurements(measurements_t &m, const AxisEnum axis) {
  */
 inline void calibrate_toolhead(measurements_t &m, const float uncertainty, const uint8_t extruder) {
   TEMPORARY_BACKLASH_CORRECTION(all_on);
-  TEMPORARY_BACKLASH_SMOOTHING(0.0f);
 
   #if HOTENDS > 1
     set_nozzle(m, extruder);
@@ -541,7 +532,6 @@ inline void calibrate_toolhead(measurements_t &m, const float uncertainty, const
  */
 inline void calibrate_all_toolheads(measurements_t &m, const float uncertainty) {
   TEMPORARY_BACKLASH_CORRECTION(all_on);
-  TEMPORARY_BACKLASH_SMOOTHING(0.0f);
 
   HOTEND_LOOP() calibrate_toolhead(m, uncertainty, e);
 
@@ -573,7 +563,6 @@ inline void calibrate_all() {
   #endif
 
   TEMPORARY_BACKLASH_CORRECTION(all_on);
-  TEMPORARY_BACKLASH_SMOOTHING(0.0f);
 
   // Do a fast and rough calibration of the toolheads
   calibrate_all_toolheads(m, CALIBRATION_MEASUREMENT_UNKNOWN);
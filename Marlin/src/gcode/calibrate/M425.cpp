@@ -33,7 +33,6 @@
  * M425: Enable and tune backlash correction.
  *
  *   F<fraction>     Enable/disable/fade-out backlash correction (0.0 to 1.0)
- *   S<smoothing_mm> Distance over which backlash correction is spread
  *   X<distance_mm>  Set the backlash distance on X (0 to disable)
  *   Y<distance_mm>                        ... on Y
  *   Z<distance_mm>                        ... on Z
@@ -60,14 +59,6 @@ void GcodeSuite::M425() {
     noArgs = false;
   }
 
-  #ifdef BACKLASH_SMOOTHING_MM
-    if (parser.seen('S')) {
-      planner.synchronize();
-      backlash.smoothing_mm = parser.value_linear_units();
-      noArgs = false;
-    }
-  #endif
-
   if (noArgs) {
     SERIAL_ECHOPGM("Backlash Correction ");
     if (!backlash.correction) SERIAL_ECHOPGM("in");
@@ -80,10 +71,6 @@ void GcodeSuite::M425() {
       SERIAL_EOL();
     }
 
-    #ifdef BACKLASH_SMOOTHING_MM
-      SERIAL_ECHOLNPAIR("  Smoothing (mm):                 S", backlash.smoothing_mm);
-    #endif
-
     #if ENABLED(MEASURE_BACKLASH_WHEN_PROBING)
       SERIAL_ECHOPGM("  Average measured backlash (mm):");
       if (backlash.has_any_measurement()) {
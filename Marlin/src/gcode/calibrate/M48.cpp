@@ -119,6 +119,11 @@ void GcodeSuite::M48() {
 
   float mean = 0.0, sigma = 0.0, min = 99999.9, max = -99999.9, sample_set[n_samples];
 
+  #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+    // How far past the trigger the probe stopped, taken out of the samples
+    float overshoot_sum = 0.0, overshoot_max = 0.0;
+  #endif
+
   // Move to the first point, deploy, and probe
   const float t = probe.probe_at_point(probe_pos, raise_after, verbose_level);
   bool probing_good = !isnan(t);
@@ -200,6 +205,11 @@ void GcodeSuite::M48() {
       probing_good = !isnan(sample_set[n]);
       if (!probing_good) break;
 
+      #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+        overshoot_sum += ABS(probe.overshoot);
+        NOLESS(overshoot_max, ABS(probe.overshoot));
+      #endif
+
       /**
        * Get the current mean for the data points we have so far
        */
@@ -230,6 +240,9 @@ void GcodeSuite::M48() {
             SERIAL_ECHOPAIR_F(" min: ", min, 3);
             SERIAL_ECHOPAIR_F(" max: ", max, 3);
             SERIAL_ECHOPAIR_F(" range: ", max-min, 3);
+            #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+              SERIAL_ECHOPAIR_F(" overshoot: ", ABS(probe.overshoot), 4);
+            #endif
           }
           SERIAL_EOL();
         }
@@ -248,6 +261,10 @@ void GcodeSuite::M48() {
       SERIAL_ECHOPAIR_F(" Min: ", min, 3);
       SERIAL_ECHOPAIR_F(" Max: ", max, 3);
       SERIAL_ECHOLNPAIR_F(" Range: ", max-min, 3);
+      #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+        SERIAL_ECHOPAIR_F("Trigger Overshoot Mean: ", overshoot_sum / n_samples, 4);
+        SERIAL_ECHOLNPAIR_F(" Max: ", overshoot_max, 4);
+      #endif
     }
 
     SERIAL_ECHOLNPAIR_F("Standard Deviation: ", sigma, 6);
@@ -31,6 +31,9 @@
  *
  * Report the current speed percentage factor if no parameter is specified
  *
+ * With QUEUED_FEEDRATE_OVERRIDE the moves already queued are replanned
+ * at the new speed from idle().
+ *
  * With PRUSA_MMU2...
  *   B : Flag to back up the current factor
  *   R : Flag to restore the last-saved factor
@@ -25,18 +25,42 @@
 #include "../../core/serial.h"
 #include "../../inc/MarlinConfig.h"
 
+// Get the S<section> parameter, or SETTINGS_ALL
+static bool get_section(SettingsSection &section) {
+  section = SETTINGS_ALL;
+  if (parser.seenval('S')) {
+    const uint8_t s = parser.value_byte();
+    if (s >= SETTINGS_SECTIONS) {
+      SERIAL_ECHOLNPGM("?Invalid section.");
+      return false;
+    }
+    section = (SettingsSection)s;
+  }
+  return true;
+}
+
 /**
  * M500: Store settings in EEPROM
+ *
+ * Only the sections that changed are written.
+ *
+ *   S<section> Store only this section (see SettingsSection)
  */
 void GcodeSuite::M500() {
-  (void)settings.save();
+  SettingsSection section;
+  if (get_section(section)) (void)settings.save(section);
 }
 
 /**
  * M501: Read settings from EEPROM
+ *
+ * Sections that fail their checksum are reset to defaults.
+ *
+ *   S<section> Read only this section, leaving the others as they are
  */
 void GcodeSuite::M501() {
-  (void)settings.load();
+  SettingsSection section;
+  if (get_section(section)) (void)settings.load(section);
 }
 
 /**
@@ -26,6 +26,8 @@
 
 #include "../../gcode.h"
 #include "../../../feature/cancel_object.h"
+#include "../../../module/motion.h"
+#include "../../../module/planner.h"
 
 /**
  * M486: A simple interface to cancel objects
@@ -36,6 +38,13 @@
  *   U<index> : Un-cancel object with the given index
  *   C        : Cancel the current object (the last index given by S<index>)
  *   S-1      : Start a non-object like a brim or purge tower that should always print
+ *
+ * The moves of a canceled object are dropped as they are read. The M486 S
+ * that ends them gets the last values they had, to carry on from there:
+ *
+ *   Z<pos>   : Move to this Z position (absolute mode only)
+ *   E<pos>   : Set this E position (absolute mode only)
+ *   F<rate>  : Set this feedrate
  */
 void GcodeSuite::M486() {
 
@@ -47,6 +56,18 @@ void GcodeSuite::M486() {
   if (parser.seen('S'))
     cancelable.set_active_object(parser.value_int());
 
+  // Carry on from the end of the dropped moves
+  if (parser.linearval('F') > 0) feedrate_mm_s = parser.value_feedrate();
+  if (parser.seenval('E') && !axis_is_relative(E_AXIS)) {
+    current_position.e = parser.value_axis_units(E_AXIS);
+    planner.set_e_position_mm(current_position.e);
+  }
+  if (parser.seenval('Z') && !axis_is_relative(Z_AXIS)) {
+    destination = current_position;
+    destination.z = LOGICAL_TO_NATIVE(parser.value_linear_units(), Z_AXIS);
+    prepare_line_to_destination();
+  }
+
   if (parser.seen('C')) cancelable.cancel_active_object();
 
   if (parser.seen('P')) cancelable.cancel_object(parser.value_int());
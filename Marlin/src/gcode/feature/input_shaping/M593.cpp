@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(INPUT_SHAPING)
+
+#include "../../gcode.h"
+#include "../../../module/stepper.h"
+
+/**
+ * M593: Set or report Input Shaping
+ *
+ *  X       Set the X axis (default both)
+ *  Y       Set the Y axis (default both)
+ *  F<hz>   Ringing frequency. 0 to disable shaping.
+ *  D<zeta> Damping ratio, from 0 to 0.5
+ *  T<type> Shaper type: 0:ZV 1:ZVD 2:MZV 3:EI
+ *
+ * With no parameters report the current settings.
+ * The steppers are allowed to finish before a change.
+ */
+void GcodeSuite::M593() {
+
+  if (!parser.seen("FDT")) {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR("Input Shaping"
+      " X T", int(stepper.shaping_type[X_AXIS]), " F", stepper.shaping_freq[X_AXIS], " D", stepper.shaping_zeta[X_AXIS],
+      " Y T", int(stepper.shaping_type[Y_AXIS]), " F", stepper.shaping_freq[Y_AXIS], " D", stepper.shaping_zeta[Y_AXIS]
+    );
+    return;
+  }
+
+  const bool seen_x = parser.seen('X'), seen_y = parser.seen('Y');
+
+  LOOP_L_N(i, 2) {
+    if ((seen_x || seen_y) && !(i ? seen_y : seen_x)) continue;
+    const float freq = parser.floatval('F', stepper.shaping_freq[i]),
+                zeta = parser.floatval('D', stepper.shaping_zeta[i]);
+    const uint8_t type = parser.byteval('T', stepper.shaping_type[i]);
+    if (!stepper.set_shaping(AxisEnum(i), freq, zeta, type)) {
+      SERIAL_ECHO_START();
+      SERIAL_CHAR(axis_codes[i]);
+      SERIAL_ECHOLNPGM(" shaping out of range.");
+    }
+  }
+}
+
+#endif // INPUT_SHAPING
@@ -22,6 +22,7 @@
 
 #include "../gcode.h"
 #include "../../module/motion.h"
+#include "../../module/planner.h"
 
 #include "../../MarlinCore.h"
 
@@ -99,12 +100,20 @@ void GcodeSuite::G0_G1(
 
     #endif // FWRETRACT
 
+    #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+      planner.feedrate_scaled = feedrate_percentage;
+    #endif
+
     #if IS_SCARA
       fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
     #else
       prepare_line_to_destination();
     #endif
 
+    #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+      planner.feedrate_scaled = 0;
+    #endif
+
     #ifdef G0_FEEDRATE
       // Restore the motion mode feedrate
       if (fast_move) feedrate_mm_s = old_feedrate;
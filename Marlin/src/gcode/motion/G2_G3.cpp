@@ -48,6 +48,10 @@
  * Arcs should only be made relatively large (over 5mm), as larger arcs with
  * larger segments will tend to be more efficient. Your slicer should have
  * options for G2/G3 arc generation. In future these options may be GCode tunable.
+ *
+ * With ARC_MAX_DEVIATION the length comes from the radius instead, as the
+ * longest chord that stays within ARC_MAX_DEVIATION of the arc. Large arcs
+ * get long segments and small arcs get short ones.
  */
 void plan_arc(
   const xyze_pos_t &cart,   // Destination position
@@ -105,7 +109,17 @@ void plan_arc(
 
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
-  #ifdef ARC_SEGMENTS_PER_R
+  #ifdef ARC_MAX_DEVIATION
+    // Chord of a circular segment whose height is the allowed deviation.
+    // MM_PER_ARC_SEGMENT is no minimum here, as small arcs need shorter chords.
+    // Arcs narrower than the deviation only need the minimum segment count.
+    float seg_length = 2 * SQRT(_MAX(0.0f, (2 * radius - (ARC_MAX_DEVIATION)) * (ARC_MAX_DEVIATION)));
+    NOLESS(seg_length, float(ARC_MAX_DEVIATION));
+    #if ARC_SEGMENTS_PER_SEC
+      // No more segments per second than the planner can take
+      NOLESS(seg_length, scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC));
+    #endif
+  #elif defined(ARC_SEGMENTS_PER_R)
     float seg_length = MM_PER_ARC_SEGMENT * radius;
     LIMIT(seg_length, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R);
   #elif ARC_SEGMENTS_PER_SEC
@@ -114,9 +128,17 @@ void plan_arc(
   #else
     constexpr float seg_length = MM_PER_ARC_SEGMENT;
   #endif
-  uint16_t segments = FLOOR(mm_of_travel / seg_length);
+  #ifdef ARC_MAX_DEVIATION
+    const float seg_count = CEIL(mm_of_travel / seg_length); // Never longer than the deviation allows
+  #else
+    const float seg_count = FLOOR(mm_of_travel / seg_length);
+  #endif
+  uint16_t segments = _MIN(seg_count, float(UINT16_MAX));   // A tiny radius on a long helix may overflow
   NOLESS(segments, min_segments);
 
+  // The chord actually traveled by each segment, for the planner to time the move
+  const float chord_mm = mm_of_travel / segments;
+
   /**
    * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
    * and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
@@ -148,8 +170,14 @@ void plan_arc(
   const float theta_per_segment = angular_travel / segments,
               linear_per_segment = linear_travel / segments,
               extruder_per_segment = extruder_travel / segments,
-              sin_T = theta_per_segment,
-              cos_T = 1 - 0.5f * sq(theta_per_segment); // Small angle approximation
+              #ifdef ARC_MAX_DEVIATION
+                // Segments may span large angles, so the approximation would drift too far
+                sin_T = sin(theta_per_segment),
+                cos_T = cos(theta_per_segment);
+              #else
+                sin_T = theta_per_segment,
+                cos_T = 1 - 0.5f * sq(theta_per_segment); // Small angle approximation
+              #endif
 
   // Initialize the linear axis
   raw[l_axis] = current_position[l_axis];
@@ -159,22 +187,42 @@ void plan_arc(
 
 
   #if ENABLED(SCARA_FEEDRATE_SCALING)
-    const float inv_duration = scaled_fr_mm_s / seg_length;
+    const float inv_duration = scaled_fr_mm_s / chord_mm;
   #endif
 
   millis_t next_idle_ms = millis() + 200UL;
 
+  #if HAS_ARC_JUNCTIONS
+    planner.begin_arc(radius, theta_per_segment);
+  #endif
+
   #if N_ARC_CORRECTION > 1
     int8_t arc_recalc_count = N_ARC_CORRECTION;
   #endif
 
-  for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
-
+  // Segments are handed to the planner in batches
+  xyze_pos_t batch[SEGMENT_BATCH_SIZE];
+  uint8_t count = 0;
+  auto flush_batch = [&]() {
     thermalManager.manage_heater();
     if (ELAPSED(millis(), next_idle_ms)) {
       next_idle_ms = millis() + 200UL;
-      idle();
+      #if HAS_ARC_JUNCTIONS
+        planner.idle_outside_arc();
+      #else
+        idle();
+      #endif
     }
+    const bool ok = planner.buffer_segments(batch, count, scaled_fr_mm_s, active_extruder, chord_mm
+      #if ENABLED(SCARA_FEEDRATE_SCALING)
+        , inv_duration
+      #endif
+    ) == count;
+    count = 0;
+    return ok;
+  };
+
+  for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
 
     #if N_ARC_CORRECTION > 1
       if (--arc_recalc_count) {
@@ -216,13 +264,10 @@ void plan_arc(
       planner.apply_leveling(raw);
     #endif
 
-    if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, seg_length
-      #if ENABLED(SCARA_FEEDRATE_SCALING)
-        , inv_duration
-      #endif
-    ))
-      break;
+    batch[count++] = raw;
+    if (count == SEGMENT_BATCH_SIZE && !flush_batch()) break;
   }
+  if (count) flush_batch();
 
   // Ensure last segment arrives at target location.
   raw = cart;
@@ -242,6 +287,10 @@ void plan_arc(
     #endif
   );
 
+  #if HAS_ARC_JUNCTIONS
+    planner.end_arc();
+  #endif
+
   #if ENABLED(AUTO_BED_LEVELING_UBL)
     raw[l_axis] = start_L;
   #endif
@@ -329,13 +378,20 @@ void GcodeSuite::G2_G3(const bool clockwise) {
         if (!WITHIN(circles_to_do, 0, 100))
           SERIAL_ERROR_MSG(STR_ERR_ARC_ARGS);
 
-        while (circles_to_do--)
+        while (circles_to_do--) {
+          TERN_(QUEUED_FEEDRATE_OVERRIDE, planner.feedrate_scaled = feedrate_percentage); // As plan_arc scales the feedrate
           plan_arc(current_position, arc_offset, clockwise);
+        }
       #endif
 
       // Send the arc to the planner
+      TERN_(QUEUED_FEEDRATE_OVERRIDE, planner.feedrate_scaled = feedrate_percentage);
       plan_arc(destination, arc_offset, clockwise);
       reset_stepper_timeout();
+
+      #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+        planner.feedrate_scaled = 0;
+      #endif
     }
     else
       SERIAL_ERROR_MSG(STR_ERR_ARC_ARGS);
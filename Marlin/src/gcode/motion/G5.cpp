@@ -25,6 +25,7 @@
 #if ENABLED(BEZIER_CURVE_SUPPORT)
 
 #include "../../module/motion.h"
+#include "../../module/planner.h"
 #include "../../module/planner_bezier.h"
 
 /**
@@ -57,7 +58,13 @@ void GcodeSuite::G5() {
       { parser.linearval('P'), parser.linearval('Q') }
     };
 
+    #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+      planner.feedrate_scaled = feedrate_percentage;
+    #endif
     cubic_b_spline(current_position, destination, offsets, MMS_SCALED(feedrate_mm_s), active_extruder);
+    #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+      planner.feedrate_scaled = 0;
+    #endif
     current_position = destination;
   }
 }
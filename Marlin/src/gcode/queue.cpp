@@ -47,6 +47,14 @@ GCodeQueue queue;
   #include "../feature/powerloss.h"
 #endif
 
+#if ENABLED(SD_LAYER_INDEX)
+  #include "../feature/layer_index.h"
+#endif
+
+#if ENABLED(CANCEL_OBJECTS)
+  #include "../feature/cancel_object.h"
+#endif
+
 /**
  * GCode line number handling. Hosts may opt to include line numbers when
  * sending commands to Marlin, and lines will be checked for sequentiality.
@@ -261,9 +269,16 @@ void GCodeQueue::ok_to_send() {
     PORT_REDIRECT(pn);                    // Reply to the serial port that sent the command
   #endif
   if (!send_ok[index_r]) return;
+  send_ok_for(command_buffer[index_r]);
+}
+
+/**
+ * Print the "ok" reply for the given line, with
+ * the ADVANCED_OK fields when enabled.
+ */
+void GCodeQueue::send_ok_for(const char *p) {
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
-    char* p = command_buffer[index_r];
     if (*p == 'N') {
       SERIAL_ECHO(' ');
       SERIAL_ECHO(*p++);
@@ -516,6 +531,15 @@ void GCodeQueue::get_serial_commands() {
           last_command_time = ms;
         #endif
 
+        #if ENABLED(CANCEL_OBJECTS)
+          // Drop the moves of a canceled object, but answer the host
+          if (cancelable.skip_line(serial_line_buffer[i])) {
+            PORT_REDIRECT(i);                  // Reply to the serial port that sent the command
+            send_ok_for(command);
+            continue;
+          }
+        #endif
+
         // Add the command to the queue
         _enqueue(serial_line_buffer[i], true
           #if NUM_SERIAL > 1
@@ -556,8 +580,13 @@ void GCodeQueue::get_serial_commands() {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command_buffer[index_w], sd_count)) {
-          _commit_command(false);
+        const bool skip = process_line_done(sd_input_state, command_buffer[index_w], sd_count);
+        #if ENABLED(SD_LAYER_INDEX)
+          layer_index.scan(command_buffer[index_w], sd_char == '\n' || card_eof);
+        #endif
+        if (!skip) {
+          if (!TERN0(CANCEL_OBJECTS, cancelable.skip_line(command_buffer[index_w])))  // Drop the moves of a canceled object
+            _commit_command(false);
           #if ENABLED(POWER_LOSS_RECOVERY)
             recovery.cmd_sdpos = card.getIndex();     // Prime for the NEXT _commit_command
           #endif
@@ -156,6 +156,8 @@ private:
 
   static void gcode_line_error(PGM_P const err, const int8_t pn);
 
+  static void send_ok_for(const char *line);
+
 };
 
 extern GCodeQueue queue;
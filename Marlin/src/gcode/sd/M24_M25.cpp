@@ -42,6 +42,10 @@
   #include "../../feature/powerloss.h"
 #endif
 
+#if ENABLED(SD_LAYER_INDEX)
+  #include "../../feature/layer_index.h"
+#endif
+
 #include "../../MarlinCore.h" // for startOrResumeJob
 
 /**
@@ -67,6 +71,9 @@ void GcodeSuite::M24() {
     #if ENABLED(POWER_LOSS_RECOVERY)
       recovery.prepare();
     #endif
+    #if ENABLED(SD_LAYER_INDEX)
+      if (!card.getIndex()) layer_index.start(); // Index prints from the top of the file
+    #endif
   }
 
   #if ENABLED(HOST_ACTION_COMMANDS)
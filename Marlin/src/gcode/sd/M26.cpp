@@ -27,11 +27,39 @@
 #include "../gcode.h"
 #include "../../sd/cardreader.h"
 
+#if ENABLED(SD_LAYER_INDEX)
+  #include "../../feature/layer_index.h"
+#endif
+
 /**
  * M26: Set SD Card file index
+ *
+ *  S<pos>    Byte position in the file
+ *
+ * With SD_LAYER_INDEX, seek to a layer indexed during the last print of
+ * the selected file, restoring temperatures, fans, feedrate and E state:
+ *
+ *  L<layer>  Layer number, from 0
+ *  Z<height> The first layer at or above this height
  */
 void GcodeSuite::M26() {
-  if (card.isMounted() && parser.seenval('S'))
+  if (!card.isMounted()) return;
+
+  #if ENABLED(SD_LAYER_INDEX)
+    if (parser.seenval('L') || parser.seenval('Z')) {
+      layer_index_entry_t entry;
+      uint16_t layer = parser.ushortval('L');
+      if (!layer_index.find(entry, layer, parser.seenval('Z') ? parser.value_linear_units() : NAN)) {
+        SERIAL_ECHOLNPGM("?Layer not in index.");
+        return;
+      }
+      layer_index.apply(entry);
+      SERIAL_ECHOLNPAIR("Layer ", layer, " Z", entry.z, " line ", entry.line, " pos ", entry.sdpos);
+      return;
+    }
+  #endif
+
+  if (parser.seenval('S'))
     card.setIndex(parser.value_long());
 }
 
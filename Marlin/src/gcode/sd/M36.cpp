@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SD_FILE_ANALYSIS)
+
+#include "../gcode.h"
+#include "../../feature/file_analysis.h"
+#include "../../libs/duration_t.h"
+
+/**
+ * M36: Report the analysis of the selected SD file
+ *
+ * The estimate assumes the current acceleration and maximum feedrates,
+ * or the M204 values found in the file.
+ */
+void GcodeSuite::M36() {
+  const file_analysis_t * const r = file_analysis.result();
+  if (!r) {
+    SERIAL_ECHOLNPAIR("File analysis: ", int(file_analysis.percent()), "%");
+    return;
+  }
+  char buffer[22];
+  duration_t(r->seconds).toString(buffer);
+  SERIAL_ECHOLNPAIR("File analysis: time:", buffer, " (", r->seconds, "s) filament:", r->filament, "mm height:", r->height, "mm layers:", r->layers);
+  SERIAL_ECHOLNPAIR("Extent X", r->min.x, ":", r->max.x, " Y", r->min.y, ":", r->max.y);
+}
+
+#endif // SD_FILE_ANALYSIS
@@ -451,6 +451,8 @@
   #error "Z_STEPPER_ALIGN_X and Z_STEPPER_ALIGN_Y are now combined as Z_STEPPER_ALIGN_XY. Please update your Configuration_adv.h."
 #elif defined(JUNCTION_DEVIATION)
   #error "JUNCTION_DEVIATION is no longer required. (See CLASSIC_JERK). Please remove it from Configuration.h."
+#elif defined(BACKLASH_SMOOTHING_MM)
+  #error "BACKLASH_SMOOTHING_MM is now BACKLASH_CORRECTION_RATE and BACKLASH_CORRECTION_ACCEL. Please update Configuration_adv.h."
 #elif defined(BABYSTEP_MULTIPLICATOR)
   #error "BABYSTEP_MULTIPLICATOR is now BABYSTEP_MULTIPLICATOR_[XY|Z]. Please update Configuration_adv.h."
 #elif defined(LULZBOT_TOUCH_UI)
@@ -703,6 +705,13 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+// Top rate and acceleration of steps timed on their own ramp (see step_ramp_t).
+// The ramp table covers 128 steps, reaching over 15 times the rate of the first step.
+#define STEP_RAMP_ASSERT(RATE, ACCEL) \
+  static_assert(WITHIN(RATE, 1, 100000), #RATE " must be from 1 to 100000."); \
+  static_assert(ACCEL > 0, #ACCEL " must be greater than 0."); \
+  static_assert(sq(float(RATE)) <= 254.0f * (ACCEL), #RATE " squared must be at most 254 * " #ACCEL ". Raise the acceleration or lower the rate.")
+
 /**
  * Babystepping
  */
@@ -723,6 +732,12 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "BABYSTEP_HOTEND_Z_OFFSET requires 2 or more HOTENDS."
   #elif BOTH(BABYSTEP_ALWAYS_AVAILABLE, MOVE_Z_WHEN_IDLE)
     #error "BABYSTEP_ALWAYS_AVAILABLE and MOVE_Z_WHEN_IDLE are incompatible."
+  #elif ENABLED(INTEGRATED_BABYSTEPPING) && (!defined(BABYSTEP_MAX_RATE) || !defined(BABYSTEP_ACCEL))
+    #error "INTEGRATED_BABYSTEPPING requires BABYSTEP_MAX_RATE and BABYSTEP_ACCEL."
+  #endif
+  #if ENABLED(INTEGRATED_BABYSTEPPING)
+    STEP_RAMP_ASSERT(BABYSTEP_MAX_RATE, BABYSTEP_ACCEL);
+    static_assert(BABYSTEP_MAX_RATE <= 8000, "BABYSTEP_MAX_RATE must be 8000 or less. Each babystep stops the stepper for 125µs.");
   #endif
 #endif
 
@@ -935,6 +950,34 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     WITHIN(LIN_ADVANCE_K, 0, 10),
     "LIN_ADVANCE_K must be a value from 0 to 10 (Changed in LIN_ADVANCE v1.5, Marlin 1.1.9)."
   );
+  #if ENABLED(LIN_ADVANCE_SMOOTHING)
+    #if ENABLED(MIXING_EXTRUDER)
+      #error "LIN_ADVANCE_SMOOTHING is not compatible with MIXING_EXTRUDER."
+    #elif !(LIN_ADVANCE_SMOOTH_TIME >= 1 && LIN_ADVANCE_SMOOTH_TIME <= 1000)
+      #error "LIN_ADVANCE_SMOOTH_TIME must be from 1 to 1000 (ms)."
+    #endif
+  #endif
+#endif
+
+/**
+ * Input Shaping
+ */
+#if ENABLED(INPUT_SHAPING)
+  #if !IS_CARTESIAN || IS_CORE
+    #error "INPUT_SHAPING requires a Cartesian machine."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "INPUT_SHAPING is not compatible with I2S_STEPPER_STREAM."
+  #elif defined(SHAPING_TYPE)
+    #error "SHAPING_TYPE is now SHAPING_TYPE_X and SHAPING_TYPE_Y. Please update Configuration_adv.h."
+  #elif !WITHIN(SHAPING_TYPE_X, 0, 3) || !WITHIN(SHAPING_TYPE_Y, 0, 3)
+    #error "SHAPING_TYPE_[XY] must be 0 (ZV), 1 (ZVD), 2 (MZV) or 3 (EI)."
+  #elif !WITHIN(SHAPING_BUFFER_SIZE, 8, 255)
+    #error "SHAPING_BUFFER_SIZE must be from 8 to 255."
+  #endif
+  static_assert(SHAPING_MIN_FREQ > 0, "SHAPING_MIN_FREQ must be greater than 0.");
+  static_assert(SHAPING_FREQ_X == 0 || SHAPING_FREQ_X >= SHAPING_MIN_FREQ, "SHAPING_FREQ_X must be 0 or at least SHAPING_MIN_FREQ.");
+  static_assert(SHAPING_FREQ_Y == 0 || SHAPING_FREQ_Y >= SHAPING_MIN_FREQ, "SHAPING_FREQ_Y must be 0 or at least SHAPING_MIN_FREQ.");
+  static_assert(WITHIN(SHAPING_ZETA_X, 0, 0.5) && WITHIN(SHAPING_ZETA_Y, 0, 0.5), "SHAPING_ZETA_X and SHAPING_ZETA_Y must be from 0 to 0.5.");
 #endif
 
 /**
@@ -1252,6 +1295,18 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Probes need Z_AFTER_PROBING >= 0."
   #endif
 
+  #if ENABLED(OPTIMIZE_PROBE_PATH)
+    #if !EITHER(ABL_GRID, AUTO_BED_LEVELING_UBL)
+      #error "OPTIMIZE_PROBE_PATH requires AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR, or AUTO_BED_LEVELING_UBL."
+    #elif !defined(PROBE_PATH_NEAR_CLEARANCE)
+      #error "OPTIMIZE_PROBE_PATH requires PROBE_PATH_NEAR_CLEARANCE."
+    #elif PROBE_PATH_NEAR_CLEARANCE <= 0 || PROBE_PATH_NEAR_CLEARANCE > Z_CLEARANCE_BETWEEN_PROBES
+      #error "PROBE_PATH_NEAR_CLEARANCE must be greater than 0 and no more than Z_CLEARANCE_BETWEEN_PROBES."
+    #elif GRID_MAX_POINTS > 255
+      #error "OPTIMIZE_PROBE_PATH is limited to 255 grid points."
+    #endif
+  #endif
+
   #if MULTIPLE_PROBING || EXTRA_PROBING
     #if !MULTIPLE_PROBING
       #error "EXTRA_PROBING requires MULTIPLE_PROBING."
@@ -1283,6 +1338,10 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Z_MIN_PROBE_REPEATABILITY_TEST requires a probe: FIX_MOUNTED_PROBE, NOZZLE_AS_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
   #endif
 
+  #if ENABLED(OPTIMIZE_PROBE_PATH)
+    #error "OPTIMIZE_PROBE_PATH requires a probe: FIX_MOUNTED_PROBE, NOZZLE_AS_PROBE, BLTOUCH, SOLENOID_PROBE, Z_PROBE_ALLEN_KEY, Z_PROBE_SLED, or Z Servo."
+  #endif
+
 #endif
 
 /**
@@ -1546,6 +1605,13 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "TEMP_SENSOR_CHAMBER 1000 requires CHAMBER_PULLUP_RESISTOR_OHMS, CHAMBER_RESISTANCE_25C_OHMS and CHAMBER_BETA in Configuration_adv.h."
 #endif
 
+/**
+ * Background ADC filtering must be provided by the HAL (currently LINUX only)
+ */
+#if ENABLED(ADC_BACKGROUND_FILTER) && !defined(HAL_ADC_FILTERED)
+  #error "ADC_BACKGROUND_FILTER is only implemented for the AVR and LINUX (simulator) HALs."
+#endif
+
 /**
  * Test Heater, Temp Sensor, and Extruder Pins; Sensor Type must also be set.
  */
@@ -1950,6 +2016,16 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+/**
+ * Arc segment length
+ */
+#if ENABLED(ARC_SUPPORT) && defined(ARC_MAX_DEVIATION)
+  #ifdef ARC_SEGMENTS_PER_R
+    #error "ARC_MAX_DEVIATION and ARC_SEGMENTS_PER_R can't both be used."
+  #endif
+  static_assert(ARC_MAX_DEVIATION > 0, "ARC_MAX_DEVIATION must be greater than 0.");
+#endif
+
 /**
  * G38 Probe Target
  */
@@ -2015,6 +2091,16 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "Please select only one of SDCARD, FLASH, or SRAM_EEPROM_EMULATION."
 #endif
 
+#if ENABLED(EEPROM_JOURNAL)
+  #if DISABLED(EEPROM_SETTINGS)
+    #error "EEPROM_JOURNAL requires EEPROM_SETTINGS."
+  #elif ANY(SDCARD_EEPROM_EMULATION, FLASH_EEPROM_EMULATION, SRAM_EEPROM_EMULATION, I2C_EEPROM, SPI_EEPROM)
+    #error "EEPROM_JOURNAL replaces the other EEPROM types. Please disable them."
+  #elif !defined(__PLAT_LINUX__)
+    #error "EEPROM_JOURNAL is only supported on LINUX for now."
+  #endif
+#endif
+
 /**
  * Make sure only one display is enabled
  */
@@ -2658,11 +2744,43 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
     #error "BACKLASH_COMPENSATION requires BACKLASH_DISTANCE_MM"
   #elif !defined(BACKLASH_CORRECTION)
     #error "BACKLASH_COMPENSATION requires BACKLASH_CORRECTION"
+  #elif !defined(BACKLASH_CORRECTION_RATE) || !defined(BACKLASH_CORRECTION_ACCEL)
+    #error "BACKLASH_COMPENSATION requires BACKLASH_CORRECTION_RATE and BACKLASH_CORRECTION_ACCEL"
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "BACKLASH_COMPENSATION is not compatible with I2S_STEPPER_STREAM."
+  #elif ENABLED(INPUT_SHAPING)
+    #error "BACKLASH_COMPENSATION is not compatible with INPUT_SHAPING."
   #elif IS_CORE
     constexpr float backlash_arr[] = BACKLASH_DISTANCE_MM;
     static_assert(!backlash_arr[CORE_AXIS_1] && !backlash_arr[CORE_AXIS_2],
                   "BACKLASH_COMPENSATION can only apply to " STRINGIFY(NORMAL_AXIS) " with your CORE system.");
   #endif
+  STEP_RAMP_ASSERT(BACKLASH_CORRECTION_RATE, BACKLASH_CORRECTION_ACCEL);
+#endif
+
+#if ENABLED(PIPELINED_PROBING)
+  #if !HAS_BED_PROBE
+    #error "PIPELINED_PROBING requires a bed probe."
+  #elif IS_KINEMATIC
+    #error "PIPELINED_PROBING is not compatible with DELTA or SCARA."
+  #elif ENABLED(SENSORLESS_PROBING)
+    #error "PIPELINED_PROBING is not compatible with SENSORLESS_PROBING."
+  #elif ENABLED(BLTOUCH) && DISABLED(BLTOUCH_HS_MODE)
+    #error "PIPELINED_PROBING requires BLTOUCH_HS_MODE with BLTOUCH."
+  #elif !defined(PIPELINED_PROBING_MARGIN)
+    #error "PIPELINED_PROBING requires PIPELINED_PROBING_MARGIN."
+  #endif
+  static_assert(PIPELINED_PROBING_MARGIN > 0, "PIPELINED_PROBING_MARGIN must be greater than 0.");
+#endif
+
+#if ENABLED(ENDSTOP_TRIGGER_TIMING)
+  #if !IS_CARTESIAN || IS_CORE
+    #error "ENDSTOP_TRIGGER_TIMING requires a Cartesian machine."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "ENDSTOP_TRIGGER_TIMING is not compatible with I2S_STEPPER_STREAM."
+  #elif ENABLED(INPUT_SHAPING)
+    #error "ENDSTOP_TRIGGER_TIMING is not compatible with INPUT_SHAPING."
+  #endif
 #endif
 
 #if ENABLED(GRADIENT_MIX) && MIXING_VIRTUAL_TOOLS < 2
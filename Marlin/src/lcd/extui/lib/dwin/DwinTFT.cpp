@@ -32,6 +32,8 @@
 #include "DwinTFT.h"
 #include "DwinTFTSerial.h"
 #include "DwinTFTCommand.h"
+#include "DwinTFTStatus.h"
+#include "DwinTFTFileBrowser.h"
 
 char _conv[8];
 
@@ -90,6 +92,7 @@ void DwinTFTClass::init()
   ExtUI::delay_ms(10);
   DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_READY);
   DWIN_TFT_SERIAL_ENTER();
+  DwinTFTStatus.invalidateAll();
 
   #if PIN_EXISTS(PS_ON)
     pinMode(PS_ON_PIN, OUTPUT);
@@ -132,17 +135,53 @@ void DwinTFTClass::tick()
   const millis_t ms = millis();
   static millis_t nextUpdateCheckMs = 0;
 
+  #if ENABLED(SDSUPPORT)
+    DwinTFTFileBrowser.idle();
+  #endif
+
   if (ELAPSED(ms, nextUpdateCheckMs)) {
     nextUpdateCheckMs = ms + DWIN_TFT_UPDATE_INTERVAL_MS;
-    loop();
+    #if ENABLED(DWIN_TFT_LOOP_STATS)
+      const uint32_t startUs = micros();
+      loop();
+      reportLoopTime(micros() - startUs);
+    #else
+      loop();
+    #endif
   }
 }
 
 void DwinTFTClass::loop()
 {
+  DwinTFTStatus.update();
+  #if ENABLED(SDSUPPORT)
+    // Leave commands and pushed status until the file list is out
+    if(DwinTFTFileBrowser.isBusy()) return;
+  #endif
   DwinTFTCommand.loop();
+  DwinTFTStatus.publish();
 }
 
+#if ENABLED(DWIN_TFT_LOOP_STATS)
+  // Sum up the time spent in loop() and print it every 10 seconds
+  void DwinTFTClass::reportLoopTime(const uint32_t us)
+  {
+    static uint32_t totalUs = 0, maxUs = 0;
+    static uint16_t runs = 0;
+    static millis_t nextReportMs = 0;
+    totalUs += us;
+    NOLESS(maxUs, us);
+    runs++;
+    const millis_t ms = millis();
+    if (ELAPSED(ms, nextReportMs)) {
+      nextReportMs = ms + 10000UL;
+      SERIAL_ECHOLNPAIR("TFT loop: avg ", totalUs / runs, "us max ", maxUs, "us runs ", runs);
+      totalUs = maxUs = 0;
+      runs = 0;
+    }
+  }
+#endif
+
 void DwinTFTClass::filamentRunout(const ExtUI::extruder_t extruder)
 {
   playErrorTone();
@@ -170,6 +209,9 @@ void DwinTFTClass::gcodeQueue(const char* gcode)
 
 void DwinTFTClass::onMediaInserted()
 {
+  #if ENABLED(SDSUPPORT)
+    DwinTFTFileBrowser.invalidate();
+  #endif
   if(ExtUI::isMediaInserted()) {
     DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_SD_CARD_INSERTED); // J00 SD Card inserted
     DWIN_TFT_SERIAL_ENTER();
@@ -181,6 +223,9 @@ void DwinTFTClass::onMediaInserted()
 
 void DwinTFTClass::onMediaError()
 {
+  #if ENABLED(SDSUPPORT)
+    DwinTFTFileBrowser.invalidate();
+  #endif
   if(!ExtUI::isMediaInserted()) {
     DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_SD_CARD_NOT_INSERTED); // J01 SD Card error
     DWIN_TFT_SERIAL_ENTER();
@@ -192,6 +237,9 @@ void DwinTFTClass::onMediaError()
 
 void DwinTFTClass::onMediaRemoved()
 {
+  #if ENABLED(SDSUPPORT)
+    DwinTFTFileBrowser.invalidate();
+  #endif
   if(!ExtUI::isMediaInserted()) {
     DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_SD_CARD_REMOVED); // J01 SD Card removed
     DWIN_TFT_SERIAL_ENTER();
@@ -303,16 +351,20 @@ void DwinTFTClass::onPidTuning(const ExtUI::result_t rst)
 
 void DwinTFTClass::onPrintTimerStarted()
 {
-
+  DwinTFTStatus.invalidate(DWIN_TFT_STATUS_SD_CARD_PRINT_STATUS);
+  DwinTFTStatus.invalidate(DWIN_TFT_STATUS_PRINTING_TIME);
 }
 
 void DwinTFTClass::onPrintTimerPaused()
 {
-
+  DwinTFTStatus.invalidate(DWIN_TFT_STATUS_SD_CARD_PRINT_STATUS);
+  DwinTFTStatus.invalidate(DWIN_TFT_STATUS_PRINTING_TIME);
 }
 
 void DwinTFTClass::onPrintTimerStopped()
 {
+  DwinTFTStatus.invalidate(DWIN_TFT_STATUS_SD_CARD_PRINT_STATUS);
+  DwinTFTStatus.invalidate(DWIN_TFT_STATUS_PRINTING_TIME);
   DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_PRINT_FINISHED);// J14 print done
   DWIN_TFT_SERIAL_ENTER();
   #ifdef DWIN_TFT_DEBUG
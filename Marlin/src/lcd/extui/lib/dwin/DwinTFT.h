@@ -95,6 +95,9 @@ private:
   void receiveCommands();
   void loop();
   void checkPowerOff();
+  #if ENABLED(DWIN_TFT_LOOP_STATS)
+    void reportLoopTime(const uint32_t us);
+  #endif
 };
 
 extern DwinTFTClass DwinTFT;
@@ -32,6 +32,7 @@
 #include "DwinTFT.h"
 #include "DwinTFTSerial.h"
 #include "DwinTFTFileBrowser.h"
+#include "DwinTFTStatus.h"
 
 DwinTFTCommandClass DwinTFTCommand;
 
@@ -44,28 +45,14 @@ void DwinTFTCommandClass::handleCommand(DwinTFTCommandsRx command)
 {
   switch(command) {
     case DWIN_TFT_RX_GET_HOTEND_TEMP: //A0 GET HOTEND TEMP
-      handleGetHotendTemp();
-      break;
     case DWIN_TFT_RX_GET_HOTEND_TARGET_TEMP: //A1  GET HOTEND TARGET TEMP
-      handleGetHotendTargetTemp();
-      break;
     case DWIN_TFT_RX_GET_HOTBED_TEMP: //A2 GET HOTBED TEMP
-      handleGetHotbedTemp();
-      break;
     case DWIN_TFT_RX_GET_HOTBED_TARGET_TEMP: //A3 GET HOTBED TARGET TEMP
-      handleGetHotbedTargetTemp();
-      break;
     case DWIN_TFT_RX_GET_FAN_SPEED://A4 GET FAN SPEED
-      handleGetFanSpeed();
-      break;
     case DWIN_TFT_RX_GET_CURRENT_COORDINATES:// A5 GET CURRENT COORDINATE
-      handleGetCurrentCoordinates();
-      break;
     case DWIN_TFT_RX_GET_SD_CARD_PRINT_STATUS: //A6 GET SD CARD PRINTING STATUS
-      handleGetSDCardPrintingStatus();
-      break;
     case DWIN_TFT_RX_GET_PRINTING_TIME://A7 GET PRINTING TIME
-      handleGetPrintingTime();
+      DwinTFTStatus.sendReply((DwinTFTStatusField)command); // status polls are answered from the cached replies
       break;
     case DWIN_TFT_RX_GET_SD_CARD_LIST: // A8 GET  SD LIST
       handleGetSDCardList();
@@ -159,143 +146,42 @@ void DwinTFTCommandClass::handleCommand(DwinTFTCommandsRx command)
 
 float DwinTFTCommandClass::codeValue()
 {
-  return (strtod(&TFTcmdbuffer[TFTbufindr][TFTstrchr_pointer - TFTcmdbuffer[TFTbufindr] + 1], NULL));
+  return (strtod(TFTstrchr_pointer + 1, NULL));
 }
 
 bool DwinTFTCommandClass::codeSeen(char code)
 {
-  TFTstrchr_pointer = strchr(TFTcmdbuffer[TFTbufindr], code);
+  TFTstrchr_pointer = strchr(TFTcmdbuffer, code);
   return (TFTstrchr_pointer != NULL); //Return True if a character was found
 }
 
 void DwinTFTCommandClass::receiveCommands()
 {
-  while( DwinTFTSerial.available() > 0  && TFTbuflen < DWIN_TFT_BUFSIZE)
+  // Lines are framed in the serial RX ring and handled right away
+  for(uint8_t lines = 0; lines < DWIN_TFT_BUFSIZE; lines++)
   {
-    serial3_char = DwinTFTSerial.read();
-    if(serial3_char == '\n' || serial3_char == '\r' || serial3_char == ':'  || serial3_count >= (DWIN_TFT_MAX_CMD_SIZE - 1) )
-    {
-      if(!serial3_count) { //if empty line
-        return;
-      }
-
-      TFTcmdbuffer[TFTbufindw][serial3_count] = 0; //terminate string
+    const int16_t len = DwinTFTSerial.readLine(TFTcmdbuffer, DWIN_TFT_MAX_CMD_SIZE);
+    if(len < 0) break;  // no whole line yet
+    if(!len) continue;  // empty line
 
-      if((strchr(TFTcmdbuffer[TFTbufindw], 'A') != NULL)) {
-        int16_t a_command;
-        TFTstrchr_pointer = strchr(TFTcmdbuffer[TFTbufindw], 'A');
-        a_command = ((int)((strtod(&TFTcmdbuffer[TFTbufindw][TFTstrchr_pointer - TFTcmdbuffer[TFTbufindw] + 1], NULL))));
+    TFTstrchr_pointer = strchr(TFTcmdbuffer, 'A');
+    if(TFTstrchr_pointer != NULL) {
+      int16_t a_command = 0; // A-codes are plain integers, no need for strtod
+      for(const char *c = TFTstrchr_pointer + 1; NUMERIC(*c); c++) a_command = a_command * 10 + (*c - '0');
 
-        #ifdef DWIN_TFT_DEBUG
-          if ((a_command>7) && (a_command != 20)) // No debugging of status polls, please!
-          SERIAL_ECHOLNPAIR("TFT Serial Command: ", TFTcmdbuffer[TFTbufindw]);
-        #endif
+      #ifdef DWIN_TFT_DEBUG
+        if ((a_command>7) && (a_command != 20)) // No debugging of status polls, please!
+        SERIAL_ECHOLNPAIR("TFT Serial Command: ", TFTcmdbuffer);
+      #endif
 
-        handleCommand((DwinTFTCommandsRx)a_command);
-      }
-      TFTbufindw = (TFTbufindw + 1) % DWIN_TFT_BUFSIZE;
-      TFTbuflen += 1;
-      serial3_count = 0; //clear buffer
-    }
-    else
-    {
-      TFTcmdbuffer[TFTbufindw][serial3_count++] = serial3_char;
+      handleCommand((DwinTFTCommandsRx)a_command);
     }
   }
 }
 
 void DwinTFTCommandClass::loop()
 {
-  if(TFTbuflen<(DWIN_TFT_BUFSIZE-1)) {
-    receiveCommands();
-  }
-  if(TFTbuflen) {
-    TFTbuflen = (TFTbuflen - 1);
-    TFTbufindr = (TFTbufindr + 1) % DWIN_TFT_BUFSIZE;
-  }
-}
-
-void DwinTFTCommandClass::handleGetHotendTemp()
-{
-  DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_HOTEND_TEMP);
-  DWIN_TFT_SERIAL_PROTOCOL(itostr3(int(ExtUI::getActualTemp_celsius(ExtUI::extruder_t::E0))));
-  DWIN_TFT_SERIAL_ENTER();
-}
-
-void DwinTFTCommandClass::handleGetHotendTargetTemp()
-{
-  DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_HOTEND_TARGET_TEMP);
-  DWIN_TFT_SERIAL_PROTOCOL(itostr3(int(ExtUI::getTargetTemp_celsius(ExtUI::extruder_t::E0))));
-  DWIN_TFT_SERIAL_ENTER();
-}
-
-void DwinTFTCommandClass::handleGetHotbedTemp()
-{
-  DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_HOTBED_TEMP);
-  DWIN_TFT_SERIAL_PROTOCOL(itostr3(int(ExtUI::getActualTemp_celsius(ExtUI::heater_t::BED))));
-  DWIN_TFT_SERIAL_ENTER();
-}
-
-void DwinTFTCommandClass::handleGetHotbedTargetTemp()
-{
-  DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_HOTBED_TARGET_TEMP);
-  DWIN_TFT_SERIAL_PROTOCOL(itostr3(int(ExtUI::getTargetTemp_celsius(ExtUI::heater_t::BED))));
-  DWIN_TFT_SERIAL_ENTER();
-}
-
-void DwinTFTCommandClass::handleGetFanSpeed()
-{
-  DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_FAN_SPEED);
-  DWIN_TFT_SERIAL_PROTOCOL(int(ExtUI::getActualFan_percent(ExtUI::fan_t::FAN0)));
-  DWIN_TFT_SERIAL_ENTER();
-}
-
-void DwinTFTCommandClass::handleGetCurrentCoordinates()
-{
-  DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_CURRENT_COORDINATES);
-  DWIN_TFT_SERIAL_SPACE();
-  DWIN_TFT_SERIAL_PROTOCOLPGM("X: ");
-  DWIN_TFT_SERIAL_PROTOCOL(ExtUI::getAxisPosition_mm(ExtUI::axis_t::X));
-  DWIN_TFT_SERIAL_SPACE();
-  DWIN_TFT_SERIAL_PROTOCOLPGM("Y: ");
-  DWIN_TFT_SERIAL_PROTOCOL(ExtUI::getAxisPosition_mm(ExtUI::axis_t::Y));
-  DWIN_TFT_SERIAL_SPACE();
-  DWIN_TFT_SERIAL_PROTOCOLPGM("Z: ");
-  DWIN_TFT_SERIAL_PROTOCOL(ExtUI::getAxisPosition_mm(ExtUI::axis_t::Z));
-  DWIN_TFT_SERIAL_SPACE();
-  DWIN_TFT_SERIAL_ENTER();
-}
-
-void DwinTFTCommandClass::handleGetSDCardPrintingStatus()
-{
-  #ifdef SDSUPPORT
-    if(ExtUI::isPrinting()) {
-      DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_PRINTING_STATUS);
-      DWIN_TFT_SERIAL_PROTOCOL(itostr3(ExtUI::getProgress_percent()));
-    } else {
-      DWIN_TFT_SERIAL_PROTOCOLPGM("A6V ---");
-    }
-    DWIN_TFT_SERIAL_ENTER();
-  #endif
-}
-
-void DwinTFTCommandClass::handleGetPrintingTime()
-{
-  DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_PRINTING_TIME);
-  duration_t elapsed = print_job_timer.duration();
-  if(elapsed.second() != 0) { // print time
-    DWIN_TFT_SERIAL_PROTOCOL(itostr2(elapsed.hour())); //hours
-    DWIN_TFT_SERIAL_SPACE();
-    DWIN_TFT_SERIAL_PROTOCOLPGM("H");
-    DWIN_TFT_SERIAL_SPACE();
-    DWIN_TFT_SERIAL_PROTOCOL(itostr2(elapsed.minute() - (elapsed.hour() * 60))); //minutes
-    DWIN_TFT_SERIAL_SPACE();
-    DWIN_TFT_SERIAL_PROTOCOLPGM("M");
-  } else {
-    DWIN_TFT_SERIAL_SPACE();
-    DWIN_TFT_SERIAL_PROTOCOLPGM("999:999");
-  }
-  DWIN_TFT_SERIAL_ENTER();
+  receiveCommands();
 }
 
 void DwinTFTCommandClass::handleGetSDCardList()
@@ -23,7 +23,7 @@
 #include "DwinTFT.h"
 
 #define DWIN_TFT_BAUDRATE 115200
-#define DWIN_TFT_BUFSIZE 4
+#define DWIN_TFT_BUFSIZE 4 // Lines handled per loop
 #define DWIN_TFT_MAX_CMD_SIZE 96
 
 enum DwinTFTCommandsRx : uint8_t {
@@ -117,21 +117,8 @@ public:
   void loop();
 
 private:
-  char TFTcmdbuffer[DWIN_TFT_BUFSIZE][DWIN_TFT_MAX_CMD_SIZE];
-  int TFTbuflen = 0;
-  int TFTbufindr = 0;
-  int TFTbufindw = 0;
-  char serial3_char;
-  int serial3_count = 0;
+  char TFTcmdbuffer[DWIN_TFT_MAX_CMD_SIZE];
   void receiveCommands();
-  void handleGetHotendTemp();
-  void handleGetHotendTargetTemp();
-  void handleGetHotbedTemp();
-  void handleGetHotbedTargetTemp();
-  void handleGetFanSpeed();
-  void handleGetCurrentCoordinates();
-  void handleGetSDCardPrintingStatus();
-  void handleGetPrintingTime();
   void handleGetSDCardList();
   void handleSDCardPause();
   void handleSDCardResume();
@@ -34,7 +34,7 @@ DwinTFTFileBrowserClass DwinTFTFileBrowser;
 
 DwinTFTFileBrowserClass::DwinTFTFileBrowserClass()
 {
-  
+  invalidate();
 }
 
 void DwinTFTFileBrowserClass::reset()
@@ -64,48 +64,134 @@ void DwinTFTFileBrowserClass::listFiles()
   } else if(strcasecmp_P(selectedDirectory, PSTR(DEBUG_MENU)) == 0) {
     buildDebugMenu(itemPos);
   } else {
-    uint16_t itemCount = fileList.count();
-    uint16_t maxItems = 0;
     if(itemPos == 0) {
       if(!fileList.isAtRootDir()) {
         DWIN_TFT_SERIAL_PROTOCOLLNPGM(DIR_UP);
         DWIN_TFT_SERIAL_PROTOCOLLNPGM(DIR_UP);
-        maxItems = constrain(3, 1, itemCount);
       } else {
         DWIN_TFT_SERIAL_PROTOCOLLNPGM(EXTRA_MENU);
         DWIN_TFT_SERIAL_PROTOCOLLNPGM(EXTRA_MENU);
-        maxItems = constrain(3, 1, itemCount);
       }
+      listPos = 0;
+      listEnd = 3;
     } else {
-      itemPos--; //items above zero are counted regular
-      maxItems = constrain(itemPos + 4, 0, itemCount);
+      listPos = itemPos - 1; //items above zero are counted regular
+      listEnd = itemPos + 3;
     }
-    
-    for(uint16_t pos = itemPos; pos < maxItems; pos++) {
-      fileList.seek(pos);
+    // The entries follow from idle()
+    #if ENABLED(DWIN_TFT_LOOP_STATS)
+      maxSliceUs = 0;
+      listSlices = 0;
+    #endif
+    listState = LIST_COUNT;
+    return;
+  }
 
-      if(fileList.isDir()) {
-        DWIN_TFT_SERIAL_PROTOCOL(fileList.shortFilename());
-        DWIN_TFT_SERIAL_PROTOCOLLNPGM("/");
-        DWIN_TFT_SERIAL_PROTOCOL(fileList.filename());
-        DWIN_TFT_SERIAL_PROTOCOLLNPGM("/");
-        SERIAL_ECHO(pos);
-        SERIAL_ECHOPGM(":");
-        SERIAL_ECHO(fileList.filename());
-        SERIAL_ECHOLNPGM("/");
-      } else {
-        DWIN_TFT_SERIAL_PROTOCOLLN(fileList.shortFilename());
-        DWIN_TFT_SERIAL_PROTOCOLLN(fileList.filename());
-        SERIAL_ECHO(pos);
-        SERIAL_ECHOPGM(":");
-        SERIAL_ECHOLN(fileList.filename());
+  finishList();
+}
+
+void DwinTFTFileBrowserClass::finishList()
+{
+  DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_SD_CARD_FILE_LIST_END); // Filelist stop
+  DWIN_TFT_SERIAL_ENTER();
+  // prohibits double entries
+  holdUntilMs = millis() + DWIN_TFT_UPDATE_INTERVAL_MS;
+  listState = LIST_HOLD;
+  #if ENABLED(DWIN_TFT_LOOP_STATS)
+    if(listSlices) SERIAL_ECHOLNPAIR("TFT file list: ", listSlices, " slices, max ", maxSliceUs, "us");
+  #endif
+}
+
+void DwinTFTFileBrowserClass::invalidate()
+{
+  for(uint8_t i = 0; i < DWIN_TFT_FILE_CACHE_SIZE; i++) cache[i].pos = 0xFFFF;
+  fileList.refresh();
+}
+
+void DwinTFTFileBrowserClass::readEntry(FileEntry &entry, const uint16_t pos)
+{
+  entry.pos = pos;
+  if(!fileList.seek(pos)) {
+    entry.isDir = false;
+    entry.shortFilename[0] = entry.filename[0] = '\0';
+    return;
+  }
+  entry.isDir = fileList.isDir();
+  strncpy(entry.shortFilename, fileList.shortFilename(), sizeof(entry.shortFilename) - 1);
+  entry.shortFilename[sizeof(entry.shortFilename) - 1] = '\0';
+  strncpy(entry.filename, fileList.filename(), sizeof(entry.filename) - 1);
+  entry.filename[sizeof(entry.filename) - 1] = '\0';
+}
+
+// Send an entry if the TX ring has room for all of it, so the TFT never waits on half a name
+bool DwinTFTFileBrowserClass::sendEntry(const FileEntry &entry)
+{
+  const size_t len = strlen(entry.shortFilename) + strlen(entry.filename) + (entry.isDir ? 2 : 0) + 4;
+  if(len <= DWIN_TFT_TX_BUFFER_SIZE && DwinTFTSerial.tx.free() < len) return false;
+
+  if(entry.isDir) {
+    DWIN_TFT_SERIAL_PROTOCOL(entry.shortFilename);
+    DWIN_TFT_SERIAL_PROTOCOLLNPGM("/");
+    DWIN_TFT_SERIAL_PROTOCOL(entry.filename);
+    DWIN_TFT_SERIAL_PROTOCOLLNPGM("/");
+    SERIAL_ECHO(entry.pos);
+    SERIAL_ECHOPGM(":");
+    SERIAL_ECHO(entry.filename);
+    SERIAL_ECHOLNPGM("/");
+  } else {
+    DWIN_TFT_SERIAL_PROTOCOLLN(entry.shortFilename);
+    DWIN_TFT_SERIAL_PROTOCOLLN(entry.filename);
+    SERIAL_ECHO(entry.pos);
+    SERIAL_ECHOPGM(":");
+    SERIAL_ECHOLN(entry.filename);
+  }
+  return true;
+}
+
+/**
+ * One slice of the file list: count the directory, or send entries until
+ * DWIN_TFT_LIST_SLICE_US is used up. Cached entries cost next to nothing,
+ * but at most one entry per slice is read from the card.
+ */
+void DwinTFTFileBrowserClass::idle()
+{
+  switch(listState) {
+    case LIST_IDLE:
+      return;
+    case LIST_HOLD:
+      if(ELAPSED(millis(), holdUntilMs)) listState = LIST_IDLE;
+      return;
+    default:
+      break;
+  }
+
+  const uint32_t startUs = micros();
+  if(!ExtUI::isMediaInserted()) {
+    listEnd = listPos; // Card pulled, close the list
+  } else if(listState == LIST_COUNT) {
+    NOMORE(listEnd, fileList.count());
+    listState = LIST_ENTRIES;
+  } else {
+    bool readCard = false;
+    while(listPos < listEnd) {
+      FileEntry &entry = cache[listPos % DWIN_TFT_FILE_CACHE_SIZE];
+      if(entry.pos != listPos) {
+        if(readCard) break;
+        readEntry(entry, listPos);
+        readCard = true;
       }
+      if(!sendEntry(entry)) break;
+      listPos++;
+      if(micros() - startUs >= DWIN_TFT_LIST_SLICE_US) break;
     }
   }
 
-  DWIN_TFT_SERIAL_PROTOCOLPGM(DWIN_TFT_TX_SD_CARD_FILE_LIST_END); // Filelist stop
-  DWIN_TFT_SERIAL_ENTER();
-  ExtUI::delay_ms(DWIN_TFT_UPDATE_INTERVAL_MS); // prohibits double entries
+  #if ENABLED(DWIN_TFT_LOOP_STATS)
+    NOLESS(maxSliceUs, micros() - startUs);
+    listSlices++;
+  #endif
+
+  if(listPos >= listEnd) finishList();
 }
 
 void DwinTFTFileBrowserClass::selectFile()
@@ -121,11 +207,13 @@ void DwinTFTFileBrowserClass::selectFile()
     DwinTFTCommand.TFTstrchr_pointer[4] == '.' && 
     DwinTFTCommand.TFTstrchr_pointer[5] == '.') { //dir up
     fileList.upDir();
+    invalidate();
     listFiles();
   } else if (DwinTFTCommand.TFTstrchr_pointer[lastCharPos] == '/') { //directory
     memcpy(selectedDirectory, DwinTFTCommand.TFTstrchr_pointer + 4, lastCharPos - 1);
     selectedDirectory[strlen(selectedDirectory) - 1] = '\0';
     fileList.changeDir(selectedDirectory);
+    invalidate();
     listFiles();
   } else if(strcasecmp_P(DwinTFTCommand.TFTstrchr_pointer + 4, PSTR(EXTRA_MENU)) == 0 || 
     strcasecmp_P(DwinTFTCommand.TFTstrchr_pointer + 4, PSTR(DEBUG_MENU)) == 0) {
@@ -173,6 +261,7 @@ void DwinTFTFileBrowserClass::refreshFileList()
   while (!fileList.isAtRootDir()) {
     fileList.upDir();
   }
+  invalidate();
   listFiles();
 }
 
@@ -21,6 +21,14 @@
 
 #include "../../../../inc/MarlinConfigPre.h"
 #include "../../../../sd/SdFatConfig.h"
+#include "../../../../core/millis_t.h"
+
+#ifndef DWIN_TFT_FILE_CACHE_SIZE
+  #define DWIN_TFT_FILE_CACHE_SIZE 4
+#endif
+#ifndef DWIN_TFT_LIST_SLICE_US
+  #define DWIN_TFT_LIST_SLICE_US 500
+#endif
 
 #define DIR_UP "../"
 #define EXTRA_MENU_DIR_UP "<../>"
@@ -44,9 +52,38 @@
 #define DEBUG_MENU_TEST_DISPLAY_TX_COMMANDS "<test display tx commands>"
 #define DEBUG_MENU_TEST_DISPLAY_INTERACTION "<test display interaction>"
 
+/**
+ * The SD file list is sent a little at a time from idle(), so paging
+ * through the card never holds up the main loop for a whole page.
+ * Entries already read are kept in a small cache of the current
+ * directory, one slot per position modulo DWIN_TFT_FILE_CACHE_SIZE.
+ */
 class DwinTFTFileBrowserClass {
 private:
+  enum ListState : uint8_t {
+    LIST_IDLE,
+    LIST_COUNT,   // Count the directory entries, which scans the whole directory
+    LIST_ENTRIES, // Send the entries of the page
+    LIST_HOLD     // Page sent, wait before taking more TFT commands
+  };
+  struct FileEntry {
+    uint16_t pos; // 0xFFFF for an empty slot
+    bool isDir;
+    char shortFilename[FILENAME_LENGTH];
+    char filename[LONG_FILENAME_LENGTH];
+  };
+  FileEntry cache[DWIN_TFT_FILE_CACHE_SIZE];
+  ListState listState = LIST_IDLE;
+  uint16_t listPos, listEnd;
+  millis_t holdUntilMs;
+  #if ENABLED(DWIN_TFT_LOOP_STATS)
+    uint32_t maxSliceUs;
+    uint16_t listSlices;
+  #endif
   uint8_t debugDisplayTxCommand = 0;
+  void readEntry(FileEntry &entry, const uint16_t pos);
+  bool sendEntry(const FileEntry &entry);
+  void finishList();
   void buildExtraMenu(uint16_t pos);
   void buildDebugMenu(uint16_t pos);
   void handleExtraMenu();
@@ -59,6 +96,9 @@ public:
   void listFiles();
   void selectFile();
   void refreshFileList();
+  void idle();
+  void invalidate();
+  bool isBusy() { return listState != LIST_IDLE; }
 };
 
 extern DwinTFTFileBrowserClass DwinTFTFileBrowser;
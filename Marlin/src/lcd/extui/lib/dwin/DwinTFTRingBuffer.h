@@ -0,0 +1,128 @@
+/**
+ * DWIN TFT Support for Anycubic i3 Mega and 4Max Pro
+ * Based on the work of Christian Hopp and David Ramiro.
+ * Copyright (c) 2020 by Jonas Plamann <https://github.com/Poket-Jony>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/**
+ * Single-producer single-consumer byte ring for the TFT serial port
+ *
+ * head is only written by the producer and tail only by the consumer, so
+ * one side may run in an ISR without locking. Both indexes run freely and
+ * are masked on access, which needs a power-of-two size. Up to 128 bytes
+ * the indexes are 8 bits wide and are read and written atomically on AVR.
+ * Larger rings use 16-bit indexes, which are read with interrupts off.
+ */
+
+#include "../../../../inc/MarlinConfig.h"
+
+template <uint16_t SIZE>
+class DwinTFTRingBuffer {
+  static_assert(SIZE >= 2 && !(SIZE & (SIZE - 1)), "DwinTFTRingBuffer size must be a power of 2.");
+
+public:
+  typedef typename IF<(SIZE > 128), uint16_t, uint8_t>::type index_t;
+
+  DwinTFTRingBuffer() { head = tail = 0; }
+
+  index_t available() const { return index_t(load(head) - tail); }
+  index_t free() const      { return SIZE - index_t(head - load(tail)); }
+  bool empty() const        { return load(head) == tail; }
+
+  //
+  // Consumer side
+  //
+
+  int read() {
+    if (empty()) return -1;
+    const uint8_t c = buffer[tail & MASK];
+    store(tail, tail + 1);
+    return c;
+  }
+
+  // Look at a byte without taking it
+  int peek(const index_t offset=0) const {
+    return offset < available() ? buffer[(tail + offset) & MASK] : -1;
+  }
+
+  // Take up to n bytes, return the number taken
+  index_t read(uint8_t *dst, index_t n) {
+    NOMORE(n, available());
+    const index_t t = tail & MASK, first = _MIN(n, index_t(SIZE - t));
+    memcpy(dst, &buffer[t], first);
+    memcpy(dst + first, buffer, n - first);
+    store(tail, tail + n);
+    return n;
+  }
+
+  void skip(index_t n) { NOMORE(n, available()); store(tail, tail + n); }
+  void clear()         { store(tail, load(head)); }
+
+  //
+  // Producer side
+  //
+
+  bool write(const uint8_t c) {
+    if (!free()) return false;
+    buffer[head & MASK] = c;
+    store(head, head + 1);
+    return true;
+  }
+
+  // Put up to n bytes, return the number put. The consumer sees them all at once.
+  index_t write(const uint8_t *src, index_t n) {
+    NOMORE(n, free());
+    const index_t h = head & MASK, first = _MIN(n, index_t(SIZE - h));
+    memcpy(&buffer[h], src, first);
+    memcpy(buffer, src + first, n - first);
+    store(head, head + n);
+    return n;
+  }
+
+  // Put as much of a PROGMEM string as fits, return the number of bytes put
+  index_t write_P(PGM_P str) {
+    index_t n = 0, h = head;
+    for (const index_t room = free(); n < room; n++, h++) {
+      const uint8_t c = pgm_read_byte(str + n);
+      if (!c) break;
+      buffer[h & MASK] = c;
+    }
+    store(head, h);
+    return n;
+  }
+
+private:
+  static constexpr index_t MASK = SIZE - 1;
+
+  uint8_t buffer[SIZE];
+  volatile index_t head, tail;
+
+  static inline index_t load(const volatile index_t &i) {
+    if (sizeof(index_t) == 1) return i;
+    CRITICAL_SECTION_START();
+    const index_t v = i;
+    CRITICAL_SECTION_END();
+    return v;
+  }
+  static inline void store(volatile index_t &i, const index_t v) {
+    if (sizeof(index_t) == 1) { i = v; return; }
+    CRITICAL_SECTION_START();
+    i = v;
+    CRITICAL_SECTION_END();
+  }
+};
@@ -2,7 +2,7 @@
  * DWIN TFT Support for Anycubic i3 Mega and 4Max Pro
  * Based on the work of Christian Hopp and David Ramiro.
  * Copyright (c) 2020 by Jonas Plamann <https://github.com/Poket-Jony>
- * 
+ *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
  * the Free Software Foundation, either version 3 of the License, or
@@ -21,277 +21,232 @@
 
 #if ENABLED(DWIN_TFT)
 
-#include <stdlib.h>
-#include <stdio.h>
-#include <string.h>
-#include <inttypes.h>
-#include "Arduino.h"
-#include "wiring_private.h"
-
-// this next line disables the entire HardwareSerial.cpp,
-// this is so I can support Attiny series and any other chip without a uart
-#if defined(UBRR3H)
-
 #include "DwinTFTSerial.h"
 
-// Define constants and variables for buffering incoming serial data.  We're
-// using a ring buffer (I think), in which head is the index of the location
-// to which to write the next incoming character and tail is the index of the
-// location from which to read.
-#if (RAMEND < 1000)
-  #define SERIAL_BUFFER_SIZE 64
-#else
-  #define SERIAL_BUFFER_SIZE 128
+#ifdef __PLAT_LINUX__
+  #include "../../../../core/serial.h"
+  #include <fcntl.h>
+  #include <stdlib.h>
+  #include <termios.h>
+  #include <unistd.h>
+#elif !defined(UBRR3H)
+  #error "DWIN_TFT requires USART3 or the LINUX pseudo-terminal."
 #endif
 
-struct ring_buffer
-{
-  unsigned char buffer[SERIAL_BUFFER_SIZE];
-  volatile unsigned int head;
-  volatile unsigned int tail;
-};
-
-#if defined(UBRR3H)
-  ring_buffer rx_buffer_ajg  =  { { 0 }, 0, 0 };
-  ring_buffer tx_buffer_ajg  =  { { 0 }, 0, 0 };
-#endif
+DwinTFTRxBuffer DwinTFTSerialClass::rx;
+DwinTFTTxBuffer DwinTFTSerialClass::tx;
 
-inline void store_char(unsigned char c, ring_buffer *buffer)
-{
-  unsigned int i = (unsigned int)(buffer->head + 1) % SERIAL_BUFFER_SIZE;
-
-  // if we should be storing the received character into the location
-  // just before the tail (meaning that the head would advance to the
-  // current location of the tail), we're about to overflow the buffer
-  // and so we don't write the character or advance the head.
-  if (i != buffer->tail) {
-    buffer->buffer[buffer->head] = c;
-    buffer->head = i;
-  }
-}
+DwinTFTSerialClass DwinTFTSerial;
 
-#if defined(USART3_RX_vect) && defined(UDR3)
-  void serialEvent3() __attribute__((weak));
-  void serialEvent3() {}
-  #define serialEvent3_implemented
-  ISR(USART3_RX_vect)
+#ifdef __PLAT_LINUX__
+
+  void DwinTFTSerialClass::begin(const uint32_t)
   {
-    if (bit_is_clear(UCSR3A, UPE3)) {
-      unsigned char c = UDR3;
-      store_char(c, &rx_buffer_ajg);
+    fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if(fd < 0 || grantpt(fd) || unlockpt(fd)) {
+      SERIAL_ECHOLNPGM("DWIN TFT: Can't open a pseudo-terminal");
+      end();
+      return;
     }
+    termios settings;
+    if(!tcgetattr(fd, &settings)) {
+      cfmakeraw(&settings);
+      tcsetattr(fd, TCSANOW, &settings);
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    SERIAL_ECHOLNPAIR("DWIN TFT on ", ptsname(fd));
   }
-#endif
 
-#ifdef USART3_UDRE_vect
-ISR(USART3_UDRE_vect)
-{
-  if (tx_buffer_ajg.head == tx_buffer_ajg.tail) {
-	// Buffer empty, so disable interrupts
-    cbi(UCSR3B, UDRIE3);
+  void DwinTFTSerialClass::end()
+  {
+    if(fd >= 0) close(fd);
+    fd = -1;
+    rx.clear();
   }
-  else {
-    // There is more data in the output buffer. Send the next byte
-    unsigned char c = tx_buffer_ajg.buffer[tx_buffer_ajg.tail];
-    tx_buffer_ajg.tail = (tx_buffer_ajg.tail + 1) % SERIAL_BUFFER_SIZE;
 
-    UDR3 = c;
+  // Move bytes between the rings and the pseudo-terminal. Stands in for the USART interrupts.
+  void DwinTFTSerialClass::service()
+  {
+    if(fd < 0) return;
+    for(int c; (c = tx.peek()) >= 0;) {
+      const uint8_t b = c;
+      if(::write(fd, &b, 1) != 1) break;
+      tx.skip(1);
+    }
+    uint8_t buffer[32];
+    for(DwinTFTRxBuffer::index_t room; (room = rx.free());) {
+      const ssize_t n = ::read(fd, buffer, _MIN(sizeof(buffer), size_t(room)));
+      if(n <= 0) break;
+      rx.write(buffer, n);
+    }
   }
-}
-#endif
 
+  void DwinTFTSerialClass::startTx() { service(); }
 
-// Constructors ////////////////////////////////////////////////////////////////
+  void DwinTFTSerialClass::flush() { service(); }
 
-DwinTFTSerialClass::DwinTFTSerialClass(ring_buffer *rx_buffer, ring_buffer *tx_buffer,
-  volatile uint8_t *ubrrh, volatile uint8_t *ubrrl,
-  volatile uint8_t *ucsra, volatile uint8_t *ucsrb,
-  volatile uint8_t *ucsrc, volatile uint8_t *udr,
-  uint8_t rxen, uint8_t txen, uint8_t rxcie, uint8_t udrie, uint8_t u2x)
-{
-  _rx_buffer = rx_buffer;
-  _tx_buffer = tx_buffer;
-  _ubrrh = ubrrh;
-  _ubrrl = ubrrl;
-  _ucsra = ucsra;
-  _ucsrb = ucsrb;
-  _ucsrc = ucsrc;
-  _udr = udr;
-  _rxen = rxen;
-  _txen = txen;
-  _rxcie = rxcie;
-  _udrie = udrie;
-  _u2x = u2x;
-}
+  // With nobody on the other end the output has nowhere to go, so don't wait for it
+  static inline bool waitForRoom() { DwinTFTSerial.flush(); return DwinTFTSerialClass::tx.free(); }
 
-// Public Methods //////////////////////////////////////////////////////////////
+#else // AVR USART3
 
-void DwinTFTSerialClass::begin(unsigned long baud)
-{
-  uint16_t baud_setting;
-  bool use_u2x = true;
-
-#if F_CPU == 16000000UL
-  // hardcoded exception for compatibility with the bootloader shipped
-  // with the Duemilanove and previous boards and the firmware on the 8U2
-  // on the Uno and Mega 2560.
-  if (baud == 57600) {
-    use_u2x = false;
-  }
-#endif
-
-try_again:
-
-  if (use_u2x) {
-    *_ucsra = 1 << _u2x;
-    baud_setting = (F_CPU / 4 / baud - 1) / 2;
-  } else {
-    *_ucsra = 0;
-    baud_setting = (F_CPU / 8 / baud - 1) / 2;
+  ISR(USART3_RX_vect)
+  {
+    const bool parityError = TEST(UCSR3A, UPE3);
+    const uint8_t c = UDR3; // Always read, to clear the interrupt
+    if(!parityError) DwinTFTSerialClass::rx.write(c);
   }
 
-  if ((baud_setting > 4095) && use_u2x)
+  ISR(USART3_UDRE_vect)
   {
-    use_u2x = false;
-    goto try_again;
+    const int c = DwinTFTSerialClass::tx.read();
+    if(c < 0)
+      CBI(UCSR3B, UDRIE3); // Nothing left to send
+    else
+      UDR3 = c;
   }
 
-  // assign the baud_setting, a.k.a. ubbr (USART Baud Rate Register)
-  *_ubrrh = baud_setting >> 8;
-  *_ubrrl = baud_setting;
-
-  transmitting = false;
+  void DwinTFTSerialClass::begin(const uint32_t baud)
+  {
+    // Double speed, except where the bootloader of 16MHz boards expects otherwise
+    bool use_u2x = !(F_CPU == 16000000UL && baud == 57600);
+    uint16_t baud_setting = (F_CPU / 4 / baud - 1) / 2;
+    if(baud_setting > 4095) use_u2x = false;
+    if(use_u2x)
+      UCSR3A = _BV(U2X3);
+    else {
+      UCSR3A = 0;
+      baud_setting = (F_CPU / 8 / baud - 1) / 2;
+    }
+    UBRR3H = baud_setting >> 8;
+    UBRR3L = baud_setting;
 
-  sbi(*_ucsrb, _rxen);
-  sbi(*_ucsrb, _txen);
-  sbi(*_ucsrb, _rxcie);
-  cbi(*_ucsrb, _udrie);
-}
+    SBI(UCSR3B, RXEN3);
+    SBI(UCSR3B, TXEN3);
+    SBI(UCSR3B, RXCIE3);
+    CBI(UCSR3B, UDRIE3);
+  }
 
-void DwinTFTSerialClass::begin(unsigned long baud, byte config)
-{
-  uint16_t baud_setting;
-  bool use_u2x = true;
-
-#if F_CPU == 16000000UL
-  // hardcoded exception for compatibility with the bootloader shipped
-  // with the Duemilanove and previous boards and the firmware on the 8U2
-  // on the Uno and Mega 2560.
-  if (baud == 57600) {
-    use_u2x = false;
+  void DwinTFTSerialClass::end()
+  {
+    flush();
+    CBI(UCSR3B, RXEN3);
+    CBI(UCSR3B, TXEN3);
+    CBI(UCSR3B, RXCIE3);
+    CBI(UCSR3B, UDRIE3);
+    rx.clear();
   }
-#endif
 
-try_again:
+  void DwinTFTSerialClass::startTx() { SBI(UCSR3B, UDRIE3); }
 
-  if (use_u2x) {
-    *_ucsra = 1 << _u2x;
-    baud_setting = (F_CPU / 4 / baud - 1) / 2;
-  } else {
-    *_ucsra = 0;
-    baud_setting = (F_CPU / 8 / baud - 1) / 2;
+  // Let the transmitter make room in the ring. With interrupts off do its job here.
+  static inline bool waitForRoom()
+  {
+    if(!ISRS_ENABLED() && TEST(UCSR3A, UDRE3)) {
+      const int c = DwinTFTSerialClass::tx.read();
+      if(c >= 0) UDR3 = c;
+    }
+    return true;
   }
 
-  if ((baud_setting > 4095) && use_u2x)
+  // Wait until the last byte is handed to the USART
+  void DwinTFTSerialClass::flush()
   {
-    use_u2x = false;
-    goto try_again;
+    while(!tx.empty()) waitForRoom();
   }
 
-  // assign the baud_setting, a.k.a. ubbr (USART Baud Rate Register)
-  *_ubrrh = baud_setting >> 8;
-  *_ubrrl = baud_setting;
-
-  //set the data bits, parity, and stop bits
-#if defined(__AVR_ATmega8__)
-  config |= 0x80; // select UCSRC register (shared with UBRRH)
 #endif
-  *_ucsrc = config;
 
-  sbi(*_ucsrb, _rxen);
-  sbi(*_ucsrb, _txen);
-  sbi(*_ucsrb, _rxcie);
-  cbi(*_ucsrb, _udrie);
+int DwinTFTSerialClass::available()
+{
+  #ifdef __PLAT_LINUX__
+    service();
+  #endif
+  return rx.available();
 }
 
-void DwinTFTSerialClass::end()
+int DwinTFTSerialClass::peek()
 {
-  // wait for transmission of outgoing data
-  while (_tx_buffer->head != _tx_buffer->tail)
-    ;
-
-  cbi(*_ucsrb, _rxen);
-  cbi(*_ucsrb, _txen);
-  cbi(*_ucsrb, _rxcie);
-  cbi(*_ucsrb, _udrie);
-
-  // clear any received data
-  _rx_buffer->head = _rx_buffer->tail;
+  #ifdef __PLAT_LINUX__
+    service();
+  #endif
+  return rx.peek();
 }
 
-int DwinTFTSerialClass::available(void)
+int DwinTFTSerialClass::read()
 {
-  return (int)(SERIAL_BUFFER_SIZE + _rx_buffer->head - _rx_buffer->tail) % SERIAL_BUFFER_SIZE;
+  #ifdef __PLAT_LINUX__
+    service();
+  #endif
+  return rx.read();
 }
 
-int DwinTFTSerialClass::peek(void)
+size_t DwinTFTSerialClass::write(const uint8_t c)
 {
-  if (_rx_buffer->head == _rx_buffer->tail) {
-    return -1;
-  } else {
-    return _rx_buffer->buffer[_rx_buffer->tail];
-  }
+  while(!tx.write(c)) if(!waitForRoom()) return 0;
+  startTx();
+  return 1;
 }
 
-int DwinTFTSerialClass::read(void)
+size_t DwinTFTSerialClass::write(const uint8_t *buffer, size_t size)
 {
-  // if the head isn't ahead of the tail, we don't have any characters
-  if (_rx_buffer->head == _rx_buffer->tail) {
-    return -1;
-  } else {
-    unsigned char c = _rx_buffer->buffer[_rx_buffer->tail];
-    _rx_buffer->tail = (unsigned int)(_rx_buffer->tail + 1) % SERIAL_BUFFER_SIZE;
-    return c;
+  size_t sent = 0;
+  while(sent < size) {
+    const DwinTFTTxBuffer::index_t n = tx.write(buffer + sent, _MIN(size - sent, size_t(DWIN_TFT_TX_BUFFER_SIZE)));
+    sent += n;
+    startTx();
+    if(!n && !waitForRoom()) break;
   }
+  return sent;
 }
 
-void DwinTFTSerialClass::flush()
+size_t DwinTFTSerialClass::writePGM(PGM_P str)
 {
-  // UDR is kept full while the buffer is not empty, so TXC triggers when EMPTY && SENT
-  while (transmitting && ! (*_ucsra & _BV(TXC0)));
-  transmitting = false;
+  size_t sent = 0;
+  while(pgm_read_byte(str + sent)) {
+    const DwinTFTTxBuffer::index_t n = tx.write_P(str + sent);
+    sent += n;
+    startTx();
+    if(!n && !waitForRoom()) break;
+  }
+  return sent;
 }
 
-size_t DwinTFTSerialClass::write(uint8_t c)
+size_t DwinTFTSerialClass::print(const long value)
 {
-  unsigned int i = (_tx_buffer->head + 1) % SERIAL_BUFFER_SIZE;
-
-  // If the output buffer is full, there's nothing for it other than to
-  // wait for the interrupt handler to empty it a bit
-  // ???: return 0 here instead?
-  while (i == _tx_buffer->tail);
-
-  _tx_buffer->buffer[_tx_buffer->head] = c;
-  _tx_buffer->head = i;
-
-  sbi(*_ucsrb, _udrie);
-  // clear the TXC bit -- "can be cleared by writing a one to its bit location"
-  transmitting = true;
-  sbi(*_ucsra, TXC0);
-
-  return 1;
+  char digits[12], *p = &digits[sizeof(digits)];
+  unsigned long v = value < 0 ? -value : value;
+  do { *--p = '0' + v % 10; v /= 10; } while(v);
+  if(value < 0) *--p = '-';
+  return write((const uint8_t*)p, &digits[sizeof(digits)] - p);
 }
 
-DwinTFTSerialClass::operator bool() {
-	return true;
+/**
+ * Frame the next line in the RX ring and copy it out in one go.
+ * Return its length, or -1 until a whole line has arrived.
+ * Each byte is looked at once, however many calls it takes.
+ */
+int16_t DwinTFTSerialClass::readLine(char *line, const uint8_t size)
+{
+  const DwinTFTRxBuffer::index_t count = available();
+  for(; scanned < count && scanned < size - 1; scanned++) {
+    const char c = rx.peek(scanned);
+    if(c == '\n' || c == '\r' || c == ':') {
+      const uint8_t len = rx.read((uint8_t*)line, scanned);
+      rx.skip(1); // The line end
+      line[len] = '\0';
+      scanned = 0;
+      return len;
+    }
+  }
+  // A line too long for the buffer or the ring is cut where it is
+  if(scanned >= size - 1 || !rx.free()) {
+    const uint8_t len = rx.read((uint8_t*)line, scanned);
+    line[len] = '\0';
+    scanned = 0;
+    return len;
+  }
+  return -1;
 }
 
-// Preinstantiate Objects //////////////////////////////////////////////////////
-
-#if defined(UBRR3H)
-  DwinTFTSerialClass DwinTFTSerial(&rx_buffer_ajg, &tx_buffer_ajg, &UBRR3H, &UBRR3L, &UCSR3A, &UCSR3B, &UCSR3C, &UDR3, RXEN3, TXEN3, RXCIE3, UDRIE3, U2X3);
 #endif
-
-#endif
-
-#endif // whole file
@@ -19,101 +19,73 @@
 
 #pragma once
 
+/**
+ * Serial port of the DWIN TFT
+ *
+ * Both directions go through a DwinTFTRingBuffer. On AVR the USART3
+ * interrupts are the other end of the rings. On LINUX the port is a
+ * pseudo-terminal, serviced whenever the port is used, and its name is
+ * printed by begin() so a TFT emulator can be attached.
+ */
+
 #include "../../../../inc/MarlinConfigPre.h"
 
-#include <inttypes.h>
-#include <avr/pgmspace.h>
+#include "DwinTFTRingBuffer.h"
 
-#include "Stream.h"
+#include <string.h>
 
-#define  FORCE_INLINE __attribute__((always_inline)) inline
+#ifndef DWIN_TFT_RX_BUFFER_SIZE
+  #define DWIN_TFT_RX_BUFFER_SIZE 128
+#endif
+#ifndef DWIN_TFT_TX_BUFFER_SIZE
+  #define DWIN_TFT_TX_BUFFER_SIZE 128
+#endif
 
-struct ring_buffer;
+typedef DwinTFTRingBuffer<DWIN_TFT_RX_BUFFER_SIZE> DwinTFTRxBuffer;
+typedef DwinTFTRingBuffer<DWIN_TFT_TX_BUFFER_SIZE> DwinTFTTxBuffer;
 
-class DwinTFTSerialClass : public Stream
+class DwinTFTSerialClass
 {
-  private:
-    ring_buffer *_rx_buffer;
-    ring_buffer *_tx_buffer;
-    volatile uint8_t *_ubrrh;
-    volatile uint8_t *_ubrrl;
-    volatile uint8_t *_ucsra;
-    volatile uint8_t *_ucsrb;
-    volatile uint8_t *_ucsrc;
-    volatile uint8_t *_udr;
-    uint8_t _rxen;
-    uint8_t _txen;
-    uint8_t _rxcie;
-    uint8_t _udrie;
-    uint8_t _u2x;
-    bool transmitting;
   public:
-    DwinTFTSerialClass(ring_buffer *rx_buffer, ring_buffer *tx_buffer,
-      volatile uint8_t *ubrrh, volatile uint8_t *ubrrl,
-      volatile uint8_t *ucsra, volatile uint8_t *ucsrb,
-      volatile uint8_t *ucsrc, volatile uint8_t *udr,
-      uint8_t rxen, uint8_t txen, uint8_t rxcie, uint8_t udrie, uint8_t u2x);
-    void begin(unsigned long);
-    void begin(unsigned long, uint8_t);
+    static DwinTFTRxBuffer rx;
+    static DwinTFTTxBuffer tx;
+
+    void begin(const uint32_t baud);
     void end();
-    virtual int available(void);
-    virtual int peek(void);
-    virtual int read(void);
-    virtual void flush(void);
-    virtual size_t write(uint8_t);
-    inline size_t write(unsigned long n) { return write((uint8_t)n); }
-    inline size_t write(long n) { return write((uint8_t)n); }
-    inline size_t write(unsigned int n) { return write((uint8_t)n); }
-    inline size_t write(int n) { return write((uint8_t)n); }
-    using Print::write; // pull in write(str) and write(buf, size) from Print
-    operator bool();
-};
+    int available();
+    int peek();
+    int read();
+    void flush();
+    size_t write(const uint8_t c);
+    size_t write(const uint8_t *buffer, size_t size);
+    size_t writePGM(PGM_P str);
+    size_t print(const char *str) { return write((const uint8_t*)str, strlen(str)); }
+    size_t print(const long value);
+    int16_t readLine(char *line, const uint8_t size);
 
-// Define config for Serial.begin(baud, config);
-#define SERIAL_5N1 0x00
-#define SERIAL_6N1 0x02
-#define SERIAL_7N1 0x04
-#define SERIAL_8N1 0x06
-#define SERIAL_5N2 0x08
-#define SERIAL_6N2 0x0A
-#define SERIAL_7N2 0x0C
-#define SERIAL_8N2 0x0E
-#define SERIAL_5E1 0x20
-#define SERIAL_6E1 0x22
-#define SERIAL_7E1 0x24
-#define SERIAL_8E1 0x26
-#define SERIAL_5E2 0x28
-#define SERIAL_6E2 0x2A
-#define SERIAL_7E2 0x2C
-#define SERIAL_8E2 0x2E
-#define SERIAL_5O1 0x30
-#define SERIAL_6O1 0x32
-#define SERIAL_7O1 0x34
-#define SERIAL_8O1 0x36
-#define SERIAL_5O2 0x38
-#define SERIAL_6O2 0x3A
-#define SERIAL_7O2 0x3C
-#define SERIAL_8O2 0x3E
-
-#if defined(UBRR3H)
-  extern DwinTFTSerialClass DwinTFTSerial;
-#endif
+  private:
+    DwinTFTRxBuffer::index_t scanned = 0; // Bytes already searched for a line end
+    void startTx();
+    #ifdef __PLAT_LINUX__
+      int fd = -1;
+      void service();
+    #endif
+};
 
-extern void serialEventRun(void) __attribute__((weak));
+extern DwinTFTSerialClass DwinTFTSerial;
 
 #define DWIN_TFT_SERIAL_PROTOCOL(x) (DwinTFTSerial.print(x))
-#define DWIN_TFT_SERIAL_PROTOCOL_F(x,y) (DwinTFTSerial.print(x,y))
 #define DWIN_TFT_SERIAL_PROTOCOLPGM(x) (DwinTFTSerialPrintPGM(PSTR(x)))
 #define DWIN_TFT_SERIAL_PROTOCOL_P(x) (DwinTFTSerialPrintPGM(x))
 #define DWIN_TFT_SERIAL_(x) (DwinTFTSerial.print(x),DwinTFTSerial.write('\n'))
-#define DWIN_TFT_SERIAL_PROTOCOLLN(x) (DwinTFTSerial.print(x),DwinTFTSerial.write('\r'),DwinTFTSerial.write('\n'))
-#define DWIN_TFT_SERIAL_PROTOCOLLNPGM(x) (DwinTFTSerialPrintPGM(PSTR(x)),DwinTFTSerial.write('\r'),DwinTFTSerial.write('\n'))
+#define DWIN_TFT_SERIAL_PROTOCOLLN(x) (DwinTFTSerial.print(x),DWIN_TFT_SERIAL_ENTER())
+#define DWIN_TFT_SERIAL_PROTOCOLLNPGM(x) (DwinTFTSerialPrintPGM(PSTR(x)),DWIN_TFT_SERIAL_ENTER())
 #define DWIN_TFT_SERIAL_PROTOCOLLNPGM_LOOP(x) (DWIN_TFT_SERIAL_PROTOCOLLNPGM(x),DWIN_TFT_SERIAL_PROTOCOLLNPGM(x))
-#define DWIN_TFT_SERIAL_PROTOCOLLN_P(x) (DwinTFTSerialPrintPGM(x),DwinTFTSerial.write('\r'),DwinTFTSerial.write('\n'))
+#define DWIN_TFT_SERIAL_PROTOCOLLN_P(x) (DwinTFTSerialPrintPGM(x),DWIN_TFT_SERIAL_ENTER())
 
-#define DWIN_TFT_SERIAL_START() (DwinTFTSerial.write('\r'),DwinTFTSerial.write('\n'))
-#define DWIN_TFT_SERIAL_CMD_SEND(x) (DwinTFTSerialPrintPGM(PSTR(x)),DwinTFTSerial.write('\r'),DwinTFTSerial.write('\n'))
-#define DWIN_TFT_SERIAL_ENTER() (DwinTFTSerial.write('\r'),DwinTFTSerial.write('\n'))
+#define DWIN_TFT_SERIAL_START() (DWIN_TFT_SERIAL_ENTER())
+#define DWIN_TFT_SERIAL_CMD_SEND(x) (DwinTFTSerialPrintPGM(PSTR(x)),DWIN_TFT_SERIAL_ENTER())
+#define DWIN_TFT_SERIAL_ENTER() (DwinTFTSerialPrintPGM(PSTR("\r\n")))
 #define DWIN_TFT_SERIAL_SPACE() (DwinTFTSerial.write(' '))
 
 const char newErr[] PROGMEM = "ERR ";
@@ -132,12 +104,7 @@ const char newSucc[] PROGMEM = "OK";
 #define DWIN_TFT_SERIAL_ECHOPGM(x) DWIN_TFT_SERIAL_PROTOCOLPGM(x)
 #define DWIN_TFT_SERIAL_ECHO(x) DWIN_TFT_SERIAL_PROTOCOL(x)
 
-FORCE_INLINE void DwinTFTSerialPrintPGM(const char *str)
+inline void DwinTFTSerialPrintPGM(PGM_P str)
 {
-  char ch=pgm_read_byte(str);
-  while(ch)
-  {
-    DwinTFTSerial.write(ch);
-    ch=pgm_read_byte(++str);
-  }
+  DwinTFTSerial.writePGM(str);
 }
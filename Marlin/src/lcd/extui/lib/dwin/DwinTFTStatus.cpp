@@ -0,0 +1,212 @@
+/**
+ * DWIN TFT Support for Anycubic i3 Mega and 4Max Pro
+ * Based on the work of Christian Hopp and David Ramiro.
+ * Copyright (c) 2020 by Jonas Plamann <https://github.com/Poket-Jony>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../../inc/MarlinConfigPre.h"
+
+#if ENABLED(DWIN_TFT)
+
+#include "../../../../MarlinCore.h"
+#include "../../../../module/printcounter.h"
+#include "../../ui_api.h"
+
+#include "DwinTFTStatus.h"
+#include "DwinTFT.h"
+#include "DwinTFTCommand.h"
+#include "DwinTFTSerial.h"
+
+DwinTFTStatusClass DwinTFTStatus;
+
+static char *appendPGM(char *p, PGM_P str)
+{
+  while((*p = pgm_read_byte(str++))) p++;
+  return p;
+}
+
+static char *appendStr(char *p, const char *str)
+{
+  while((*p = *str++)) p++;
+  return p;
+}
+
+static char *appendInt(char *p, int32_t value)
+{
+  char digits[11];
+  uint8_t n = 0;
+  if(value < 0) { *p++ = '-'; value = -value; }
+  do { digits[n++] = '0' + value % 10; value /= 10; } while(value);
+  while(n) *p++ = digits[--n];
+  *p = '\0';
+  return p;
+}
+
+// Hundredths as a float with two decimals, the same as Print::print(float)
+static char *appendHundredths(char *p, int32_t value)
+{
+  if(value < 0) { *p++ = '-'; value = -value; }
+  p = appendInt(p, value / 100);
+  *p++ = '.';
+  *p++ = '0' + (value / 10) % 10;
+  *p++ = '0' + value % 10;
+  *p = '\0';
+  return p;
+}
+
+DwinTFTStatusClass::DwinTFTStatusClass()
+{
+  invalidateAll();
+}
+
+void DwinTFTStatusClass::invalidate(const DwinTFTStatusField field)
+{
+  SBI(stale, field);
+}
+
+void DwinTFTStatusClass::invalidateAll()
+{
+  stale = 0xFF;
+}
+
+void DwinTFTStatusClass::update()
+{
+  for(uint8_t f = 0; f < DWIN_TFT_STATUS_FIELDS; f++) {
+    int32_t value = 0;
+    bool changed = TEST(stale, f);
+    switch(f) {
+      case DWIN_TFT_STATUS_HOTEND_TEMP:
+        value = int(ExtUI::getActualTemp_celsius(ExtUI::extruder_t::E0));
+        break;
+      case DWIN_TFT_STATUS_HOTEND_TARGET_TEMP:
+        value = int(ExtUI::getTargetTemp_celsius(ExtUI::extruder_t::E0));
+        break;
+      case DWIN_TFT_STATUS_HOTBED_TEMP:
+        value = int(ExtUI::getActualTemp_celsius(ExtUI::heater_t::BED));
+        break;
+      case DWIN_TFT_STATUS_HOTBED_TARGET_TEMP:
+        value = int(ExtUI::getTargetTemp_celsius(ExtUI::heater_t::BED));
+        break;
+      case DWIN_TFT_STATUS_FAN_SPEED:
+        value = int(ExtUI::getActualFan_percent(ExtUI::fan_t::FAN0));
+        break;
+      case DWIN_TFT_STATUS_CURRENT_COORDINATES: {
+        const int32_t coordinates[3] = {
+          int32_t(LROUND(ExtUI::getAxisPosition_mm(ExtUI::axis_t::X) * 100)),
+          int32_t(LROUND(ExtUI::getAxisPosition_mm(ExtUI::axis_t::Y) * 100)),
+          int32_t(LROUND(ExtUI::getAxisPosition_mm(ExtUI::axis_t::Z) * 100))
+        };
+        for(uint8_t i = 0; i < 3; i++) {
+          if(coordinates[i] != coordinatesKey[i]) changed = true;
+          coordinatesKey[i] = coordinates[i];
+        }
+      } break;
+      case DWIN_TFT_STATUS_SD_CARD_PRINT_STATUS:
+        value = ExtUI::isPrinting() ? ExtUI::getProgress_percent() : -1;
+        break;
+      case DWIN_TFT_STATUS_PRINTING_TIME: {
+        #if ENABLED(SD_FILE_ANALYSIS)
+          // Time left, once the file has been analyzed
+          const uint32_t remaining = ExtUI::getProgress_seconds_remaining();
+          if(remaining) { value = int32_t((remaining + 59) / 60); break; }
+        #endif
+        const duration_t elapsed = print_job_timer.duration();
+        value = elapsed.second() ? int32_t(elapsed.minute()) : -1;
+      } break;
+    }
+    if(value != key[f]) changed = true;
+    key[f] = value;
+    if(changed) {
+      render((DwinTFTStatusField)f);
+      SBI(dirty, f);
+    }
+  }
+  stale = 0;
+}
+
+void DwinTFTStatusClass::render(const DwinTFTStatusField field)
+{
+  char *p = reply[field];
+  const int32_t value = key[field];
+  switch(field) {
+    case DWIN_TFT_STATUS_HOTEND_TEMP:
+      p = appendStr(appendPGM(p, PSTR(DWIN_TFT_TX_HOTEND_TEMP)), itostr3(value));
+      break;
+    case DWIN_TFT_STATUS_HOTEND_TARGET_TEMP:
+      p = appendStr(appendPGM(p, PSTR(DWIN_TFT_TX_HOTEND_TARGET_TEMP)), itostr3(value));
+      break;
+    case DWIN_TFT_STATUS_HOTBED_TEMP:
+      p = appendStr(appendPGM(p, PSTR(DWIN_TFT_TX_HOTBED_TEMP)), itostr3(value));
+      break;
+    case DWIN_TFT_STATUS_HOTBED_TARGET_TEMP:
+      p = appendStr(appendPGM(p, PSTR(DWIN_TFT_TX_HOTBED_TARGET_TEMP)), itostr3(value));
+      break;
+    case DWIN_TFT_STATUS_FAN_SPEED:
+      p = appendInt(appendPGM(p, PSTR(DWIN_TFT_TX_FAN_SPEED)), value);
+      break;
+    case DWIN_TFT_STATUS_CURRENT_COORDINATES:
+      p = appendPGM(p, PSTR(DWIN_TFT_TX_CURRENT_COORDINATES " X: "));
+      p = appendPGM(appendHundredths(p, coordinatesKey[0]), PSTR(" Y: "));
+      p = appendPGM(appendHundredths(p, coordinatesKey[1]), PSTR(" Z: "));
+      p = appendPGM(appendHundredths(p, coordinatesKey[2]), PSTR(" "));
+      break;
+    case DWIN_TFT_STATUS_SD_CARD_PRINT_STATUS:
+      #ifdef SDSUPPORT
+        if(value >= 0)
+          p = appendStr(appendPGM(p, PSTR(DWIN_TFT_TX_PRINTING_STATUS)), itostr3(value));
+        else
+          p = appendPGM(p, PSTR("A6V ---"));
+      #else
+        // Not answered without SD support
+        replyLength[field] = 0;
+        return;
+      #endif
+      break;
+    case DWIN_TFT_STATUS_PRINTING_TIME:
+      p = appendPGM(p, PSTR(DWIN_TFT_TX_PRINTING_TIME));
+      if(value >= 0) {
+        p = appendPGM(appendStr(p, itostr2(value / 60)), PSTR(" H "));   // hours
+        p = appendPGM(appendStr(p, itostr2(value % 60)), PSTR(" M"));    // minutes
+      } else {
+        p = appendPGM(p, PSTR(" 999:999"));
+      }
+      break;
+    default:
+      return;
+  }
+  p = appendPGM(p, PSTR("\r\n"));
+  replyLength[field] = p - reply[field];
+}
+
+void DwinTFTStatusClass::sendReply(const DwinTFTStatusField field)
+{
+  if(replyLength[field]) DwinTFTSerial.write((const uint8_t*)reply[field], replyLength[field]);
+  CBI(dirty, field);
+}
+
+void DwinTFTStatusClass::publish()
+{
+  #if ENABLED(DWIN_TFT_PUSH_STATUS)
+    const millis_t ms = millis();
+    if(dirty && ELAPSED(ms, nextPushMs)) {
+      nextPushMs = ms + DWIN_TFT_PUSH_INTERVAL_MS;
+      for(uint8_t f = 0; f < DWIN_TFT_STATUS_FIELDS; f++)
+        if(TEST(dirty, f)) sendReply((DwinTFTStatusField)f);
+    }
+  #endif
+}
+
+#endif
@@ -0,0 +1,71 @@
+/**
+ * DWIN TFT Support for Anycubic i3 Mega and 4Max Pro
+ * Based on the work of Christian Hopp and David Ramiro.
+ * Copyright (c) 2020 by Jonas Plamann <https://github.com/Poket-Jony>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/**
+ * Status fields polled by the TFT with A0..A7
+ *
+ * Each field is sampled once per TFT loop and its reply line is only
+ * rendered again when the value behind it changed. Polls are answered
+ * straight from the rendered line. With DWIN_TFT_PUSH_STATUS the changed
+ * lines are also sent unasked, at most once per DWIN_TFT_PUSH_INTERVAL_MS.
+ */
+
+#include "../../../../inc/MarlinConfigPre.h"
+#include "../../../../core/millis_t.h"
+
+#define DWIN_TFT_STATUS_REPLY_SIZE 40
+
+// Field numbers match the A-codes that poll them
+enum DwinTFTStatusField : uint8_t {
+  DWIN_TFT_STATUS_HOTEND_TEMP = 0,
+  DWIN_TFT_STATUS_HOTEND_TARGET_TEMP = 1,
+  DWIN_TFT_STATUS_HOTBED_TEMP = 2,
+  DWIN_TFT_STATUS_HOTBED_TARGET_TEMP = 3,
+  DWIN_TFT_STATUS_FAN_SPEED = 4,
+  DWIN_TFT_STATUS_CURRENT_COORDINATES = 5,
+  DWIN_TFT_STATUS_SD_CARD_PRINT_STATUS = 6,
+  DWIN_TFT_STATUS_PRINTING_TIME = 7,
+  DWIN_TFT_STATUS_FIELDS = 8
+};
+
+class DwinTFTStatusClass {
+public:
+  DwinTFTStatusClass();
+  void update();
+  void invalidate(const DwinTFTStatusField field);
+  void invalidateAll();
+  void sendReply(const DwinTFTStatusField field);
+  void publish();
+
+private:
+  char reply[DWIN_TFT_STATUS_FIELDS][DWIN_TFT_STATUS_REPLY_SIZE];
+  uint8_t replyLength[DWIN_TFT_STATUS_FIELDS];
+  int32_t key[DWIN_TFT_STATUS_FIELDS]; // The value each reply was rendered from
+  int32_t coordinatesKey[3];
+  uint8_t stale;                       // Fields to render again regardless of their key
+  uint8_t dirty;                       // Fields changed since the TFT last saw them
+  #if ENABLED(DWIN_TFT_PUSH_STATUS)
+    millis_t nextPushMs = 0;
+  #endif
+  void render(const DwinTFTStatusField field);
+};
+
+extern DwinTFTStatusClass DwinTFTStatus;
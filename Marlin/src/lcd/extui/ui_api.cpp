@@ -106,6 +106,10 @@
   #include "../../feature/host_actions.h"
 #endif
 
+#if ENABLED(SD_FILE_ANALYSIS)
+  #include "../../feature/file_analysis.h"
+#endif
+
 namespace ExtUI {
   static struct {
     uint8_t printer_killed : 1;
@@ -842,11 +846,6 @@ namespace ExtUI {
 
     float getBacklashCorrection_percent()             { return ui8_to_percent(backlash.correction); }
     void setBacklashCorrection_percent(const float value) { backlash.correction = map(constrain(value, 0, 100), 0, 100, 0, 255); }
-
-    #ifdef BACKLASH_SMOOTHING_MM
-      float getBacklashSmoothing_mm()                 { return backlash.smoothing_mm; }
-      void setBacklashSmoothing_mm(const float value) { backlash.smoothing_mm = constrain(value, 0, 999); }
-    #endif
   #endif
 
   uint8_t getProgress_percent() {
@@ -858,6 +857,16 @@ namespace ExtUI {
     return elapsed.value;
   }
 
+  #if ENABLED(SD_FILE_ANALYSIS)
+    bool isFileAnalysisDone()             { return file_analysis.result(); }
+    uint8_t getFileAnalysis_percent()     { return file_analysis.percent(); }
+    uint32_t getFileAnalysis_seconds()    { return isFileAnalysisDone() ? file_analysis.result()->seconds : 0; }
+    float getFileAnalysis_filament_mm()   { return isFileAnalysisDone() ? file_analysis.result()->filament : 0; }
+    float getFileAnalysis_height_mm()     { return isFileAnalysisDone() ? file_analysis.result()->height : 0; }
+    uint16_t getFileAnalysis_layers()     { return isFileAnalysisDone() ? file_analysis.result()->layers : 0; }
+    uint32_t getProgress_seconds_remaining() { return isPrinting() ? file_analysis.remaining_seconds() : 0; }
+  #endif
+
   #if HAS_LEVELING
     bool getLevelingActive() { return planner.leveling_active; }
     void setLevelingActive(const bool state) { set_bed_leveling_enabled(state); }
@@ -870,6 +879,8 @@ namespace ExtUI {
           Z_VALUES(pos.x, pos.y) = zoff;
           #if ENABLED(ABL_BILINEAR_SUBDIVISION)
             bed_level_virt_interpolate();
+          #elif ENABLED(MESH_BED_LEVELING)
+            mbl.refresh_point(pos.x, pos.y);
           #endif
         }
       }
@@ -131,6 +131,17 @@ namespace ExtUI {
   uint8_t getProgress_percent();
   uint32_t getProgress_seconds_elapsed();
 
+  #if ENABLED(SD_FILE_ANALYSIS)
+    // Background analysis of the selected file
+    bool isFileAnalysisDone();
+    uint8_t getFileAnalysis_percent();
+    uint32_t getFileAnalysis_seconds();
+    float getFileAnalysis_filament_mm();
+    float getFileAnalysis_height_mm();
+    uint16_t getFileAnalysis_layers();
+    uint32_t getProgress_seconds_remaining();
+  #endif
+
   #if HAS_LEVELING
     bool getLevelingActive();
     void setLevelingActive(const bool);
@@ -222,11 +233,6 @@ namespace ExtUI {
 
     float getBacklashCorrection_percent();
     void setBacklashCorrection_percent(const float);
-
-    #ifdef BACKLASH_SMOOTHING_MM
-      float getBacklashSmoothing_mm();
-      void setBacklashSmoothing_mm(const float);
-    #endif
   #endif
 
   #if HAS_FILAMENT_SENSOR
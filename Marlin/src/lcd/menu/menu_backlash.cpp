@@ -43,10 +43,6 @@ void menu_backlash() {
   if (AXIS_CAN_CALIBRATE(B)) EDIT_BACKLASH_DISTANCE(B);
   if (AXIS_CAN_CALIBRATE(C)) EDIT_BACKLASH_DISTANCE(C);
 
-  #ifdef BACKLASH_SMOOTHING_MM
-    EDIT_ITEM_FAST(float43, MSG_BACKLASH_SMOOTHING, &backlash.smoothing_mm, 0.0f, 9.9f);
-  #endif
-
   END_MENU();
 }
 
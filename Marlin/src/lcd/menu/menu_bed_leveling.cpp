@@ -201,6 +201,9 @@
 #if ENABLED(MESH_EDIT_MENU)
 
   inline void refresh_planner() {
+    #if ENABLED(MESH_BED_LEVELING)
+      mbl.refresh();
+    #endif
     set_current_from_steppers_for_axis(ALL_AXES);
     sync_plan_position();
   }
@@ -37,7 +37,7 @@
  */
 
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V76"
+#define EEPROM_VERSION "V79"
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
@@ -155,9 +155,15 @@ extern const char SP_X_STR[], SP_Y_STR[], SP_Z_STR[], SP_E_STR[];
  * Keep this data structure up to date so
  * EEPROM size is known at compile time!
  */
+typedef struct {
+  uint16_t  size, crc;                                  // Bytes and checksum of the section data
+  uint8_t   version, reserved;                          // Layout version of the section
+} settings_section_t;
+
 typedef struct SettingsDataStruct {
   char      version[4];                                 // Vnn\0
-  uint16_t  crc;                                        // Data Checksum
+  uint16_t  crc;                                        // Checksum of the section table
+  settings_section_t section[SETTINGS_SECTIONS];        // One entry per SettingsSection
 
   //
   // DISTINCT_E_FACTORS
@@ -342,6 +348,12 @@ typedef struct SettingsDataStruct {
   //
   uint32_t motor_current_setting[3];                    // M907 X Z E
 
+  //
+  // INPUT_SHAPING
+  //
+  float shaping_freq[2], shaping_zeta[2];               // M593 X Y F D
+  uint8_t shaping_type[2];                              // M593 X Y T
+
   //
   // CNC_COORDINATE_SYSTEMS
   //
@@ -371,7 +383,6 @@ typedef struct SettingsDataStruct {
   //
   xyz_float_t backlash_distance_mm;                     // M425 X Y Z
   uint8_t backlash_correction;                          // M425 F
-  float backlash_smoothing_mm;                          // M425 S
 
   //
   // EXTENSIBLE_UI
@@ -439,6 +450,8 @@ void MarlinSettings::postprocess() {
 
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
     refresh_bed_level();
+  #elif ENABLED(MESH_BED_LEVELING)
+    mbl.refresh();
   #endif
 
   #if HAS_MOTOR_CURRENT_PWM
@@ -517,10 +530,13 @@ void MarlinSettings::postprocess() {
                                   int eeprom_index = EEPROM_OFFSET
   #define EEPROM_FINISH()         persistentStore.access_finish()
   #define EEPROM_SKIP(VAR)        (eeprom_index += sizeof(VAR))
-  #define EEPROM_WRITE(VAR)       do{ persistentStore.write_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc);              }while(0)
+  #define EEPROM_WRITE(VAR)       do{ if (TEST(section_writes, current_section)) persistentStore.write_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc); \
+                                      else { crc16(&working_crc, &VAR, sizeof(VAR)); EEPROM_SKIP(VAR); }                                  }while(0)
+  #define EEPROM_WRITE_ALWAYS(VAR) do{ persistentStore.write_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc);              }while(0)
   #define EEPROM_READ(VAR)        do{ persistentStore.read_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc, !validating);  }while(0)
   #define EEPROM_READ_ALWAYS(VAR) do{ persistentStore.read_data(eeprom_index, (uint8_t*)&VAR, sizeof(VAR), &working_crc);               }while(0)
   #define EEPROM_ASSERT(TST,ERR)  do{ if (!(TST)) { SERIAL_ERROR_MSG(ERR); eeprom_error = true; } }while(0)
+  #define EEPROM_SECTION(S)       section_begin(S, eeprom_index, working_crc)
 
   #if ENABLED(DEBUG_EEPROM_READWRITE)
     #define _FIELD_TEST(FIELD) \
@@ -534,8 +550,55 @@ void MarlinSettings::postprocess() {
 
   const char version[4] = EEPROM_VERSION;
 
+  // Bump the version of a section when its fields change
+  const uint8_t section_version[SETTINGS_SECTIONS] = { 1, 1, 1, 1, 1, 1, 1, 2, 1 };
+
+  #define ALL_SECTIONS (_BV(SETTINGS_SECTIONS) - 1)
+
+  static enum : uint8_t { SECTIONS_SAVE, SECTIONS_CHECK, SECTIONS_APPLY } section_mode;
+  static settings_section_t stored_section[SETTINGS_SECTIONS];  // The section table in EEPROM
+  static uint16_t section_crc[SETTINGS_SECTIONS], section_size[SETTINGS_SECTIONS],
+                  section_writes,   // Sections to write, saving
+                  section_valid,    // Sections that match the table, after validate()
+                  section_apply;    // Sections to apply, loading
+  static uint8_t current_section;
+  static int section_index;
+
   bool MarlinSettings::eeprom_error, MarlinSettings::validating;
 
+  /**
+   * Close the current section and start the next. Saving, this collects
+   * each section's size and checksum. Validating, it compares them with
+   * the stored table. Loading, sections not to be applied are only read.
+   */
+  void MarlinSettings::section_begin(const uint8_t section, const int eeprom_index, uint16_t &working_crc) {
+    if (current_section < SETTINGS_SECTIONS) {
+      const uint8_t c = current_section;
+      section_crc[c] = working_crc;
+      section_size[c] = eeprom_index - section_index;
+      if (section_mode == SECTIONS_CHECK
+        && stored_section[c].crc == section_crc[c]
+        && stored_section[c].size == section_size[c]
+        && stored_section[c].version == section_version[c]
+      ) SBI(section_valid, c);
+    }
+    current_section = section;
+    section_index = eeprom_index;
+    working_crc = 0;
+    if (section_mode == SECTIONS_APPLY)
+      validating = section < SETTINGS_SECTIONS && !TEST(section_apply, section);
+  }
+
+  // Read the stored version and section table. Return the table checksum.
+  static uint16_t read_header(int &eeprom_index, char (&stored_ver)[4], uint16_t &stored_crc) {
+    uint16_t crc = 0;
+    persistentStore.read_data(eeprom_index, (uint8_t*)stored_ver, sizeof(stored_ver), &crc);
+    persistentStore.read_data(eeprom_index, (uint8_t*)&stored_crc, sizeof(stored_crc), &crc);
+    crc = 0;
+    persistentStore.read_data(eeprom_index, (uint8_t*)stored_section, sizeof(stored_section), &crc);
+    return crc;
+  }
+
   bool MarlinSettings::size_error(const uint16_t size) {
     if (size != datasize()) {
       DEBUG_ERROR_MSG("EEPROM datasize error.");
@@ -546,23 +609,93 @@ void MarlinSettings::postprocess() {
 
   /**
    * M500 - Store Configuration
+   *
+   * Every section is checksummed as it is in memory, and only the
+   * sections that differ from the stored table are written. With
+   * a section given, only that section is considered.
    */
-  bool MarlinSettings::save() {
-    float dummyf = 0;
-    char ver[4] = "ERR";
-
-    uint16_t working_crc = 0;
-
+  bool MarlinSettings::save(const SettingsSection section/*=SETTINGS_ALL*/) {
     EEPROM_START();
 
     eeprom_error = false;
 
-    // Write or Skip version. (Flash doesn't allow rewrite without erase.)
-    TERN(FLASH_EEPROM_EMULATION, EEPROM_SKIP, EEPROM_WRITE)(ver);
+    char stored_ver[4];
+    uint16_t stored_crc;
+    const bool header_ok = read_header(eeprom_index, stored_ver, stored_crc) == stored_crc
+                        && strncmp(version, stored_ver, 3) == 0;
+
+    // Checksum the sections without writing
+    section_mode = SECTIONS_SAVE;
+    section_writes = 0;
+    uint16_t eeprom_size = _save();
+
+    // Without a good table all sections are written
+    uint8_t written = 0;
+    LOOP_L_N(s, SETTINGS_SECTIONS)
+      if (!header_ok || ((section == SETTINGS_ALL || section == s)
+        && (stored_section[s].crc != section_crc[s] || stored_section[s].size != section_size[s] || stored_section[s].version != section_version[s]))
+      ) { SBI(section_writes, s); written++; }
+
+    if (!eeprom_error) {
+      if (section_writes) {
+        // Write or Skip an invalid version until the sections are written. (Flash doesn't allow rewrite without erase.)
+        const char ver[4] = "ERR";
+        uint16_t working_crc = 0;
+        eeprom_index = EEPROM_OFFSET;
+        TERN(FLASH_EEPROM_EMULATION, EEPROM_SKIP, EEPROM_WRITE_ALWAYS)(ver);
+
+        eeprom_size = _save();
+        LOOP_L_N(s, SETTINGS_SECTIONS) if (TEST(section_writes, s)) {
+          stored_section[s].size = section_size[s];
+          stored_section[s].crc = section_crc[s];
+          stored_section[s].version = section_version[s];
+          stored_section[s].reserved = 0;
+        }
+
+        // Write the header last. A section cut short fails its own checksum.
+        uint16_t table_crc = 0;
+        crc16(&table_crc, stored_section, sizeof(stored_section));
+        eeprom_index = EEPROM_OFFSET;
+        EEPROM_WRITE_ALWAYS(version);
+        EEPROM_WRITE_ALWAYS(table_crc);
+        EEPROM_WRITE_ALWAYS(stored_section);
+        stored_crc = table_crc;
+      }
+
+      // Report storage size
+      DEBUG_ECHO_START();
+      DEBUG_ECHOLNPAIR("Settings Stored (", eeprom_size, " bytes; crc ", (uint32_t)stored_crc, "; ", int(written), " sections written)");
+
+      eeprom_error |= size_error(eeprom_size);
+    }
+    EEPROM_FINISH();
+
+    //
+    // UBL Mesh
+    //
+    #if ENABLED(UBL_SAVE_ACTIVE_ON_M500)
+      if (ubl.storage_slot >= 0)
+        store_mesh(ubl.storage_slot);
+    #endif
 
-    EEPROM_SKIP(working_crc); // Skip the checksum slot
+    #if ENABLED(EXTENSIBLE_UI)
+      ExtUI::onConfigurationStoreWritten(!eeprom_error);
+    #endif
+
+    return !eeprom_error;
+  }
+
+  /**
+   * Serialize the settings. Sections in section_writes are written, the
+   * others are only checksummed. Return the size of the data.
+   */
+  uint16_t MarlinSettings::_save() {
+    float dummyf = 0;
+    uint16_t working_crc = 0;
+    int eeprom_index = EEPROM_OFFSET + offsetof(SettingsData, esteppers);
 
-    working_crc = 0; // clear before first "real data"
+    current_section = SETTINGS_SECTIONS;
+    EEPROM_SECTION(SETTINGS_MOTION);
 
     _FIELD_TEST(esteppers);
 
@@ -633,6 +766,8 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(runout_distance_mm);
     }
 
+    EEPROM_SECTION(SETTINGS_LEVELING);
+
     //
     // Global Leveling
     //
@@ -668,6 +803,8 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    EEPROM_SECTION(SETTINGS_PROBE);
+
     //
     // Probe XYZ Offsets
     //
@@ -681,6 +818,8 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(zpo);
     }
 
+    EEPROM_SECTION(SETTINGS_ABL);
+
     //
     // Planar Bed Leveling matrix
     //
@@ -732,6 +871,8 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(storage_slot);
     }
 
+    EEPROM_SECTION(SETTINGS_MACHINE);
+
     //
     // Servo Angles
     //
@@ -833,6 +974,8 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(ui_preheat_fan_speed);
     }
 
+    EEPROM_SECTION(SETTINGS_THERMAL);
+
     //
     // PIDTEMP
     //
@@ -890,6 +1033,8 @@ void MarlinSettings::postprocess() {
     }
     #endif
 
+    EEPROM_SECTION(SETTINGS_FEATURES);
+
     //
     // LCD Contrast
     //
@@ -965,6 +1110,8 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    EEPROM_SECTION(SETTINGS_STEPPERS);
+
     //
     // TMC Configuration
     //
@@ -1252,6 +1399,26 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    //
+    // Input Shaping
+    //
+    {
+      _FIELD_TEST(shaping_freq);
+
+      #if ENABLED(INPUT_SHAPING)
+        EEPROM_WRITE(stepper.shaping_freq);
+        EEPROM_WRITE(stepper.shaping_zeta);
+        EEPROM_WRITE(stepper.shaping_type);
+      #else
+        const float no_shaping[4] = { 0 };
+        const uint8_t no_type[2] = { 0 };
+        EEPROM_WRITE(no_shaping);
+        EEPROM_WRITE(no_type);
+      #endif
+    }
+
+    EEPROM_SECTION(SETTINGS_EXTRAS);
+
     //
     // CNC Coordinate Systems
     //
@@ -1302,15 +1469,9 @@ void MarlinSettings::postprocess() {
         const xyz_float_t backlash_distance_mm{0};
         const uint8_t backlash_correction = 0;
       #endif
-      #if ENABLED(BACKLASH_GCODE) && defined(BACKLASH_SMOOTHING_MM)
-        const float &backlash_smoothing_mm = backlash.smoothing_mm;
-      #else
-        const float backlash_smoothing_mm = 3;
-      #endif
       _FIELD_TEST(backlash_distance_mm);
       EEPROM_WRITE(backlash_distance_mm);
       EEPROM_WRITE(backlash_correction);
-      EEPROM_WRITE(backlash_smoothing_mm);
     }
 
     //
@@ -1332,40 +1493,9 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(case_light_brightness);
     #endif
 
-    //
-    // Validate CRC and Data Size
-    //
-    if (!eeprom_error) {
-      const uint16_t eeprom_size = eeprom_index - (EEPROM_OFFSET),
-                     final_crc = working_crc;
-
-      // Write the EEPROM header
-      eeprom_index = EEPROM_OFFSET;
-
-      EEPROM_WRITE(version);
-      EEPROM_WRITE(final_crc);
-
-      // Report storage size
-      DEBUG_ECHO_START();
-      DEBUG_ECHOLNPAIR("Settings Stored (", eeprom_size, " bytes; crc ", (uint32_t)final_crc, ")");
-
-      eeprom_error |= size_error(eeprom_size);
-    }
-    EEPROM_FINISH();
-
-    //
-    // UBL Mesh
-    //
-    #if ENABLED(UBL_SAVE_ACTIVE_ON_M500)
-      if (ubl.storage_slot >= 0)
-        store_mesh(ubl.storage_slot);
-    #endif
-
-    #if ENABLED(EXTENSIBLE_UI)
-      ExtUI::onConfigurationStoreWritten(!eeprom_error);
-    #endif
+    EEPROM_SECTION(SETTINGS_SECTIONS);
 
-    return !eeprom_error;
+    return eeprom_index - (EEPROM_OFFSET);
   }
 
   /**
@@ -1377,10 +1507,8 @@ void MarlinSettings::postprocess() {
     EEPROM_START();
 
     char stored_ver[4];
-    EEPROM_READ_ALWAYS(stored_ver);
-
     uint16_t stored_crc;
-    EEPROM_READ_ALWAYS(stored_crc);
+    const uint16_t table_crc = read_header(eeprom_index, stored_ver, stored_crc);
 
     // Version has to match or defaults are used
     if (strncmp(version, stored_ver, 3) != 0) {
@@ -1395,9 +1523,21 @@ void MarlinSettings::postprocess() {
       #endif
       eeprom_error = true;
     }
+    else if (table_crc != stored_crc) {
+      eeprom_error = true;
+      DEBUG_ERROR_START();
+      DEBUG_ECHOLNPAIR("EEPROM CRC mismatch - (stored) ", stored_crc, " != ", table_crc, " (calculated)!");
+      #if HAS_LCD_MENU && DISABLED(EEPROM_AUTO_INIT)
+        ui.set_status_P(GET_TEXT(MSG_ERR_EEPROM_CRC));
+      #endif
+    }
     else {
       float dummyf = 0;
-      working_crc = 0;  // Init to 0. Accumulated by EEPROM_READ
+
+      // Validating, find the good sections. Loading, apply the chosen ones.
+      section_mode = validating ? SECTIONS_CHECK : SECTIONS_APPLY;
+      current_section = SETTINGS_SECTIONS;
+      EEPROM_SECTION(SETTINGS_MOTION);
 
       _FIELD_TEST(esteppers);
 
@@ -1490,6 +1630,8 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      EEPROM_SECTION(SETTINGS_LEVELING);
+
       //
       // Global Leveling
       //
@@ -1521,6 +1663,8 @@ void MarlinSettings::postprocess() {
         #endif // MESH_BED_LEVELING
       }
 
+      EEPROM_SECTION(SETTINGS_PROBE);
+
       //
       // Probe Z Offset
       //
@@ -1534,6 +1678,8 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(zpo);
       }
 
+      EEPROM_SECTION(SETTINGS_ABL);
+
       //
       // Planar Bed Leveling matrix
       //
@@ -1586,6 +1732,8 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(ubl_storage_slot);
       }
 
+      EEPROM_SECTION(SETTINGS_MACHINE);
+
       //
       // SERVO_ANGLES
       //
@@ -1689,6 +1837,8 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(ui_preheat_fan_speed);   // 2 floats
       }
 
+      EEPROM_SECTION(SETTINGS_THERMAL);
+
       //
       // Hotend PID
       //
@@ -1752,6 +1902,8 @@ void MarlinSettings::postprocess() {
       }
       #endif
 
+      EEPROM_SECTION(SETTINGS_FEATURES);
+
       //
       // LCD Contrast
       //
@@ -1831,6 +1983,8 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      EEPROM_SECTION(SETTINGS_STEPPERS);
+
       //
       // TMC Stepper Settings
       //
@@ -2098,6 +2252,24 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // Input Shaping
+      //
+      {
+        float shaping_freq[2], shaping_zeta[2];
+        uint8_t shaping_type[2];
+        _FIELD_TEST(shaping_freq);
+        EEPROM_READ(shaping_freq);
+        EEPROM_READ(shaping_zeta);
+        EEPROM_READ(shaping_type);
+        #if ENABLED(INPUT_SHAPING)
+          if (!validating) LOOP_L_N(i, 2)
+            stepper.set_shaping(AxisEnum(i), shaping_freq[i], shaping_zeta[i], shaping_type[i]);
+        #endif
+      }
+
+      EEPROM_SECTION(SETTINGS_EXTRAS);
+
       //
       // CNC Coordinate System
       //
@@ -2162,15 +2334,9 @@ void MarlinSettings::postprocess() {
           float backlash_distance_mm[XYZ];
           uint8_t backlash_correction;
         #endif
-        #if ENABLED(BACKLASH_GCODE) && defined(BACKLASH_SMOOTHING_MM)
-          const float &backlash_smoothing_mm = backlash.smoothing_mm;
-        #else
-          float backlash_smoothing_mm;
-        #endif
         _FIELD_TEST(backlash_distance_mm);
         EEPROM_READ(backlash_distance_mm);
         EEPROM_READ(backlash_correction);
-        EEPROM_READ(backlash_smoothing_mm);
       }
 
       //
@@ -2194,6 +2360,8 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(case_light_brightness);
       #endif
 
+      EEPROM_SECTION(SETTINGS_SECTIONS);
+
       eeprom_error = size_error(eeprom_index - (EEPROM_OFFSET));
       if (eeprom_error) {
         DEBUG_ECHO_START();
@@ -2202,10 +2370,11 @@ void MarlinSettings::postprocess() {
           ui.set_status_P(GET_TEXT(MSG_ERR_EEPROM_INDEX));
         #endif
       }
-      else if (working_crc != stored_crc) {
-        eeprom_error = true;
-        DEBUG_ERROR_START();
-        DEBUG_ECHOLNPAIR("EEPROM CRC mismatch - (stored) ", stored_crc, " != ", working_crc, " (calculated)!");
+      else if (validating && section_valid != ALL_SECTIONS) {
+        LOOP_L_N(s, SETTINGS_SECTIONS) if (!TEST(section_valid, s)) {
+          DEBUG_ERROR_START();
+          DEBUG_ECHOLNPAIR("EEPROM CRC mismatch in section ", int(s), " - (stored) ", stored_section[s].crc, " != ", section_crc[s], " (calculated)!");
+        }
         #if HAS_LCD_MENU && DISABLED(EEPROM_AUTO_INIT)
           ui.set_status_P(GET_TEXT(MSG_ERR_EEPROM_CRC));
         #endif
@@ -2213,7 +2382,7 @@ void MarlinSettings::postprocess() {
       else if (!validating) {
         DEBUG_ECHO_START();
         DEBUG_ECHO(version);
-        DEBUG_ECHOLNPAIR(" stored settings retrieved (", eeprom_index - (EEPROM_OFFSET), " bytes; crc ", (uint32_t)working_crc, ")");
+        DEBUG_ECHOLNPAIR(" stored settings retrieved (", eeprom_index - (EEPROM_OFFSET), " bytes; crc ", (uint32_t)stored_crc, ")");
       }
 
       if (!validating && !eeprom_error) postprocess();
@@ -2267,6 +2436,8 @@ void MarlinSettings::postprocess() {
 
   bool MarlinSettings::validate() {
     validating = true;
+    eeprom_error = false;
+    section_valid = 0;
     #ifdef ARCHIM2_SPI_FLASH_EEPROM_BACKUP_SIZE
       bool success = _load();
       if (!success && restoreEEPROM()) {
@@ -2277,17 +2448,26 @@ void MarlinSettings::postprocess() {
       const bool success = _load();
     #endif
     validating = false;
-    return success;
+    return success && section_valid == ALL_SECTIONS;
   }
 
-  bool MarlinSettings::load() {
-    if (validate()) {
+  /**
+   * M501 - Load the sections that pass their checksum, or just the one given.
+   * Failed sections keep their defaults.
+   */
+  bool MarlinSettings::load(const SettingsSection section/*=SETTINGS_ALL*/) {
+    (void)validate();
+    const uint16_t wanted = section == SETTINGS_ALL ? ALL_SECTIONS : _BV(section);
+    if (!eeprom_error && (section_valid & wanted)) {
+      section_apply = section_valid & wanted;
+      if (section_apply != wanted) reset();
       const bool success = _load();
       #if ENABLED(EXTENSIBLE_UI)
         ExtUI::onConfigurationStoreRead(success);
       #endif
-      return success;
+      return success && section_apply == wanted;
     }
+    if (section != SETTINGS_ALL) return false; // Leave the other settings alone
     reset();
     #if ENABLED(EEPROM_AUTO_INIT)
       (void)save();
@@ -2392,7 +2572,7 @@ void MarlinSettings::postprocess() {
 
 #else // !EEPROM_SETTINGS
 
-  bool MarlinSettings::save() {
+  bool MarlinSettings::save(const SettingsSection/*=SETTINGS_ALL*/) {
     DEBUG_ERROR_MSG("EEPROM disabled");
     return false;
   }
@@ -2480,9 +2660,6 @@ void MarlinSettings::reset() {
     backlash.correction = (BACKLASH_CORRECTION) * 255;
     constexpr xyz_float_t tmp = BACKLASH_DISTANCE_MM;
     backlash.distance_mm = tmp;
-    #ifdef BACKLASH_SMOOTHING_MM
-      backlash.smoothing_mm = BACKLASH_SMOOTHING_MM;
-    #endif
   #endif
 
   #if ENABLED(EXTENSIBLE_UI)
@@ -2729,6 +2906,15 @@ void MarlinSettings::reset() {
     }
   #endif
 
+  //
+  // Input Shaping
+  //
+
+  #if ENABLED(INPUT_SHAPING)
+    stepper.set_shaping(X_AXIS, SHAPING_FREQ_X, SHAPING_ZETA_X, SHAPING_TYPE_X);
+    stepper.set_shaping(Y_AXIS, SHAPING_FREQ_Y, SHAPING_ZETA_Y, SHAPING_TYPE_Y);
+  #endif
+
   //
   // Motor Current PWM
   //
@@ -3626,6 +3812,15 @@ void MarlinSettings::reset() {
       #endif
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      CONFIG_ECHO_HEADING("Input Shaping:");
+      LOOP_L_N(i, 2) {
+        CONFIG_ECHO_START();
+        SERIAL_ECHOLNPAIR_P(i ? PSTR("  M593 Y F") : PSTR("  M593 X F"), stepper.shaping_freq[i],
+          PSTR(" D"), stepper.shaping_zeta[i], PSTR(" T"), int(stepper.shaping_type[i]));
+      }
+    #endif
+
     #if HAS_MOTOR_CURRENT_PWM
       CONFIG_ECHO_HEADING("Stepper motor currents:");
       CONFIG_ECHO_START();
@@ -3664,9 +3859,6 @@ void MarlinSettings::reset() {
         , SP_X_STR, LINEAR_UNIT(backlash.distance_mm.x)
         , SP_Y_STR, LINEAR_UNIT(backlash.distance_mm.y)
         , SP_Z_STR, LINEAR_UNIT(backlash.distance_mm.z)
-        #ifdef BACKLASH_SMOOTHING_MM
-          , PSTR(" S"), LINEAR_UNIT(backlash.smoothing_mm)
-        #endif
       );
     #endif
 
@@ -27,12 +27,31 @@
   #include "../HAL/shared/eeprom_api.h"
 #endif
 
+/**
+ * Settings are stored in sections, each with its own size, version and
+ * checksum. Only the sections that changed are written, and a section
+ * that fails its checksum only resets that section to defaults.
+ */
+enum SettingsSection : uint8_t {
+  SETTINGS_MOTION,      // M92 M201 M203 M204 M205 M206 M218 M412
+  SETTINGS_LEVELING,    // M420 Z, Mesh Bed Leveling
+  SETTINGS_PROBE,       // M851
+  SETTINGS_ABL,         // Planar and bilinear leveling, UBL state
+  SETTINGS_MACHINE,     // M281 M871 BLTouch M665 M666 M422 M145
+  SETTINGS_THERMAL,     // M301 M304 M305
+  SETTINGS_FEATURES,    // M250 M710 M413 M207-M209 M200
+  SETTINGS_STEPPERS,    // M906 M913 M914 M569 M900 M907 M593
+  SETTINGS_EXTRAS,      // G54-G59.3 M852 M603 M217 M425, UI data, case light
+  SETTINGS_SECTIONS,
+  SETTINGS_ALL = SETTINGS_SECTIONS
+};
+
 class MarlinSettings {
   public:
     static uint16_t datasize();
 
     static void reset();
-    static bool save();    // Return 'true' if data was saved
+    static bool save(const SettingsSection section=SETTINGS_ALL); // Return 'true' if data was saved
 
     FORCE_INLINE static bool init_eeprom() {
       reset();
@@ -54,7 +73,7 @@ class MarlinSettings {
 
     #if ENABLED(EEPROM_SETTINGS)
 
-      static bool load();      // Return 'true' if data was loaded ok
+      static bool load(const SettingsSection section=SETTINGS_ALL); // Return 'true' if data was loaded ok
       static bool validate();  // Return 'true' if EEPROM data is ok
 
       static inline void first_load() {
@@ -76,7 +95,7 @@ class MarlinSettings {
       #endif
     #else
       FORCE_INLINE
-      static bool load() { reset(); report(); return true; }
+      static bool load(const SettingsSection=SETTINGS_ALL) { reset(); report(); return true; }
       FORCE_INLINE
       static void first_load() { (void)load(); }
     #endif
@@ -102,6 +121,8 @@ class MarlinSettings {
       #endif
 
       static bool _load();
+      static uint16_t _save();
+      static void section_begin(const uint8_t section, const int eeprom_index, uint16_t &working_crc);
       static bool size_error(const uint16_t size);
     #endif
 };
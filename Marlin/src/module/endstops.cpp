@@ -55,6 +55,10 @@ Endstops endstops;
 bool Endstops::enabled, Endstops::enabled_globally; // Initialized by settings.load()
 volatile uint8_t Endstops::hit_state;
 
+#if ENABLED(ENDSTOP_TRIGGER_TIMING)
+  uint32_t Endstops::edge_clock;
+#endif
+
 Endstops::esbits_t Endstops::live_state = 0;
 
 #if ENDSTOP_NOISE_THRESHOLD
@@ -514,6 +518,22 @@ void _O2 Endstops::report_states() {
 // Check endstops - Could be called from Temperature ISR!
 void Endstops::update() {
 
+  #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+    // Time a change on the step timeline. An interrupt comes with the edge.
+    // A polled change came, on average, half way since the last poll.
+    const uint32_t now = stepper.step_clock_now();
+    #if ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+      const uint32_t edge = now;
+    #else
+      static uint32_t last_poll; // = 0
+      const uint32_t edge = now - (now - last_poll) / 2;
+      last_poll = now;
+    #endif
+    #if !ENDSTOP_NOISE_THRESHOLD
+      edge_clock = edge;
+    #endif
+  #endif
+
   #if !ENDSTOP_NOISE_THRESHOLD
     if (!abort_enabled()) return;
   #endif
@@ -675,6 +695,9 @@ void Endstops::update() {
     if (old_live_state != live_state) {
       endstop_poll_count = ENDSTOP_NOISE_THRESHOLD;
       old_live_state = live_state;
+      #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+        edge_clock = edge;              // The change is timed from its first sample
+      #endif
     }
     else if (endstop_poll_count && !--endstop_poll_count)
       validated_live_state = live_state;
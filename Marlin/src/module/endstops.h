@@ -74,6 +74,10 @@ class Endstops {
   public:
     Endstops() {};
 
+    #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+      static uint32_t edge_clock;           // Step clock time of the last endstop change
+    #endif
+
     /**
      * Initialize the endstop pins
      */
@@ -720,6 +720,144 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
   thermalManager.manage_heater();  // Returns immediately on most calls
 }
 
+#if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES) && EITHER(MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR)
+  #define SEGMENT_ON_MESH_GRID 1
+#endif
+
+#if IS_KINEMATIC || ENABLED(SEGMENT_LEVELED_MOVES) || SEGMENT_ON_MESH_GRID
+
+  #if SEGMENT_ON_MESH_GRID
+
+    /**
+     * Walk the mesh grid lines crossed by a move along one axis,
+     * giving the fraction of the move where each crossing occurs.
+     * Lines at the mesh edges are skipped since the edge cells
+     * extend beyond the mesh.
+     */
+    class grid_crossings {
+      float start, dist, first, spacing;
+      int16_t line, dir, last;
+    public:
+      float t; // Fraction of the move at the next crossing, or 1 if there are no more
+
+      void begin(const float &s, const float &d, const float &grid_start, const float &grid_spacing, const uint8_t points) {
+        start = s; dist = d; first = grid_start; spacing = grid_spacing; last = points - 2;
+        const int16_t cell = constrain(int16_t(FLOOR((s - grid_start) / grid_spacing)), 0, last);
+        dir = d > 0 ? 1 : -1;
+        line = d > 0 ? cell + 1 : cell;
+        update();
+        if (t <= 0) next(); // Starting on a grid line isn't a crossing
+      }
+
+      void next() { line += dir; update(); }
+
+    private:
+      void update() {
+        t = (dist && WITHIN(line, 1, last)) ? (first + line * spacing - start) / dist : 1;
+        NOMORE(t, 1);
+      }
+    };
+
+  #endif
+
+  /**
+   * The segmenter for kinematic and leveled moves.
+   *
+   * Split the move from current_position to destination into 'segments'
+   * equal parts, plus (with 'grid') the points where it crosses a mesh grid
+   * line, and hand them to the planner in batches of SEGMENT_BATCH_SIZE.
+   *
+   *  fr_mm_s  - the feedrate of the move
+   *  segments - the number of equal parts, at least 1
+   *  move_mm  - the length of the move
+   *  grid     - also end segments on mesh grid lines
+   */
+  static void segment_line_to_destination(const feedRate_t &fr_mm_s, const uint16_t segments, const float &move_mm
+    #if SEGMENT_ON_MESH_GRID
+      , const bool grid
+    #endif
+  ) {
+    const xyze_pos_t start = current_position;
+    const xyze_float_t diff = destination - start;
+    const float inv_segments = 1.0f / float(segments);
+
+    #if SEGMENT_ON_MESH_GRID
+      // With splits on the grid the planner works out the length of each segment
+      const float segment_mm = grid ? 0.0f : move_mm * inv_segments;
+
+      grid_crossings cross_x, cross_y;
+      if (grid) {
+        mesh_grid_t g;
+        get_mesh_grid(g);
+        cross_x.begin(start.x, diff.x, g.start.x, g.spacing.x, g.points.x);
+        cross_y.begin(start.y, diff.y, g.start.y, g.spacing.y, g.points.y);
+      }
+      else
+        cross_x.t = cross_y.t = 1;
+    #else
+      const float segment_mm = move_mm * inv_segments;
+    #endif
+
+    #if ENABLED(SCARA_FEEDRATE_SCALING)
+      const float inv_duration = fr_mm_s / segment_mm;
+    #endif
+
+    #if BOTH(MESH_BED_LEVELING, SEGMENT_LEVELED_MOVES)
+      // Step through the mesh along the line instead of interpolating every segment
+      mesh_bed_leveling::line_evaluator mesh_z;
+      mesh_z.begin(start, diff * inv_segments);
+      constexpr bool leveled = true;
+    #elif HAS_LEVELING
+      constexpr bool leveled = false;
+    #endif
+
+    xyze_pos_t batch[SEGMENT_BATCH_SIZE];
+    uint8_t count = 0;
+    uint16_t seg = 1;
+    millis_t next_idle_ms = millis() + 200UL;
+
+    for (;;) {
+      // The next segment ends at the nearest division or grid crossing.
+      // Points that nearly coincide are merged to avoid tiny segments.
+      float t = seg < segments ? seg * inv_segments : 1.0f;
+      #if SEGMENT_ON_MESH_GRID
+        NOMORE(t, cross_x.t);
+        NOMORE(t, cross_y.t);
+        constexpr float merge_t = 0.0001f;
+        while (cross_x.t < t + merge_t && cross_x.t < 1) cross_x.next();
+        while (cross_y.t < t + merge_t && cross_y.t < 1) cross_y.next();
+        if (seg < segments && seg * inv_segments < t + merge_t) seg++;
+      #else
+        seg++;
+      #endif
+
+      const bool last = t >= 1;
+      xyze_pos_t &target = batch[count++];
+      target = last ? destination : start + diff * t;
+
+      #if BOTH(MESH_BED_LEVELING, SEGMENT_LEVELED_MOVES)
+        target.z += mbl.z_offset + mesh_z.next() * planner.fade_scaling_factor_for_z(target.z);
+      #endif
+
+      if (last || count == SEGMENT_BATCH_SIZE) {
+        segment_idle(next_idle_ms);
+        if (planner.buffer_segments(batch, count, fr_mm_s, active_extruder, segment_mm
+          #if ENABLED(SCARA_FEEDRATE_SCALING)
+            , inv_duration
+          #endif
+          #if HAS_LEVELING
+            , leveled
+          #endif
+        ) < count) return;
+        count = 0;
+      }
+
+      if (last) break;
+    }
+  }
+
+#endif // IS_KINEMATIC || SEGMENT_LEVELED_MOVES || SEGMENT_ON_MESH_GRID
+
 #if IS_KINEMATIC
 
   #if IS_SCARA
@@ -742,14 +880,11 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
    * Called from prepare_line_to_destination as the
    * default Delta/SCARA segmenter.
    *
-   * This calls planner.buffer_line several times, adding
-   * small incremental moves for DELTA or SCARA.
+   * The move is split by segments-per-second and handed
+   * to segment_line_to_destination.
    *
    * For Unified Bed Leveling (Delta or Segmented Cartesian)
    * the ubl.line_to_destination_segmented method replaces this.
-   *
-   * For Auto Bed Leveling (Bilinear) with SEGMENT_LEVELED_MOVES
-   * this is replaced by segmented_line_to_destination below.
    */
   inline bool line_to_destination_kinematic() {
 
@@ -791,45 +926,14 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     // At least one segment is required
     NOLESS(segments, 1U);
 
-    // The approximate length of each segment
-    const float inv_segments = 1.0f / float(segments),
-                cartesian_segment_mm = cartesian_mm * inv_segments;
-    const xyze_float_t segment_distance = diff * inv_segments;
-
-    #if ENABLED(SCARA_FEEDRATE_SCALING)
-      const float inv_duration = scaled_fr_mm_s / cartesian_segment_mm;
-    #endif
-
     /*
     SERIAL_ECHOPAIR("mm=", cartesian_mm);
     SERIAL_ECHOPAIR(" seconds=", seconds);
     SERIAL_ECHOPAIR(" segments=", segments);
-    SERIAL_ECHOPAIR(" segment_mm=", cartesian_segment_mm);
     SERIAL_EOL();
     //*/
 
-    // Get the current position as starting point
-    xyze_pos_t raw = current_position;
-
-    // Calculate and execute the segments
-    millis_t next_idle_ms = millis() + 200UL;
-    while (--segments) {
-      segment_idle(next_idle_ms);
-      raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
-        #if ENABLED(SCARA_FEEDRATE_SCALING)
-          , inv_duration
-        #endif
-      ))
-        break;
-    }
-
-    // Ensure last segment arrives at target location.
-    planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
-      #if ENABLED(SCARA_FEEDRATE_SCALING)
-        , inv_duration
-      #endif
-    );
+    segment_line_to_destination(scaled_fr_mm_s, segments, cartesian_mm);
 
     return false; // caller will update current_position
   }
@@ -841,9 +945,8 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     /**
      * Prepare a segmented move on a CARTESIAN setup.
      *
-     * This calls planner.buffer_line several times, adding
-     * small incremental moves. This allows the planner to
-     * apply more detailed bed leveling to the full move.
+     * The move is split into pieces of at most 'segment_size'
+     * so the leveling correction can follow the bed closely.
      */
     inline void segmented_line_to_destination(const feedRate_t &fr_mm_s, const float segment_size=LEVELED_SEGMENT_LENGTH) {
 
@@ -867,42 +970,7 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       uint16_t segments = cartesian_mm / segment_size;
       NOLESS(segments, 1U);
 
-      // The approximate length of each segment
-      const float inv_segments = 1.0f / float(segments),
-                  cartesian_segment_mm = cartesian_mm * inv_segments;
-      const xyze_float_t segment_distance = diff * inv_segments;
-
-      #if ENABLED(SCARA_FEEDRATE_SCALING)
-        const float inv_duration = scaled_fr_mm_s / cartesian_segment_mm;
-      #endif
-
-      // SERIAL_ECHOPAIR("mm=", cartesian_mm);
-      // SERIAL_ECHOLNPAIR(" segments=", segments);
-      // SERIAL_ECHOLNPAIR(" segment_mm=", cartesian_segment_mm);
-
-      // Get the raw current position as starting point
-      xyze_pos_t raw = current_position;
-
-      // Calculate and execute the segments
-      millis_t next_idle_ms = millis() + 200UL;
-      while (--segments) {
-        segment_idle(next_idle_ms);
-        raw += segment_distance;
-        if (!planner.buffer_line(raw, fr_mm_s, active_extruder, cartesian_segment_mm
-          #if ENABLED(SCARA_FEEDRATE_SCALING)
-            , inv_duration
-          #endif
-        ))
-          break;
-      }
-
-      // Since segment_distance is only approximate,
-      // the final move must be to the exact destination.
-      planner.buffer_line(destination, fr_mm_s, active_extruder, cartesian_segment_mm
-        #if ENABLED(SCARA_FEEDRATE_SCALING)
-          , inv_duration
-        #endif
-      );
+      segment_line_to_destination(fr_mm_s, segments, cartesian_mm);
     }
 
   #endif // SEGMENT_LEVELED_MOVES
@@ -927,16 +995,13 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
           return false; // caller will update current_position
         #else
           /**
-           * For MBL and ABL-BILINEAR only segment moves when X or Y are involved.
+           * For MBL and ABL-BILINEAR only segment moves when X or Y are involved,
+           * splitting them where they cross the mesh grid.
            * Otherwise fall through to do a direct single move.
            */
           if (xy_pos_t(current_position) != xy_pos_t(destination)) {
-            #if ENABLED(MESH_BED_LEVELING)
-              mbl.line_to_destination(scaled_fr_mm_s);
-            #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
-              bilinear_line_to_destination(scaled_fr_mm_s);
-            #endif
-            return true;
+            segment_line_to_destination(scaled_fr_mm_s, 1, (destination - current_position).magnitude(), true);
+            return false; // caller will update current_position
           }
         #endif
       }
@@ -1580,6 +1645,14 @@ void homeaxis(const AxisEnum axis) {
     if (axis == Z_AXIS) bltouch.stow(); // Intermediate STOW (in LOW SPEED MODE)
   #endif
 
+  #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+    // An edge timed by an endstop interrupt is as good fast as slow, so home in one pass.
+    // Polled endstops are only timed to within a poll, so they still bump, and so do
+    // axes that started on the switch or align extra endstops on the slow pass.
+    const bool timed_home = ENABLED(ENDSTOP_INTERRUPTS_FEATURE) && stepper.triggered_on_edge(axis)
+                         && !TERN0(HAS_EXTRA_ENDSTOPS, stepper.separate_multi_axis);
+  #endif
+
   // When homing Z with probe respect probe clearance
   const float bump = axis_home_dir * (
     #if HOMING_Z_WITH_PROBE
@@ -1589,7 +1662,7 @@ void homeaxis(const AxisEnum axis) {
   );
 
   // If a second homing move is configured...
-  if (bump) {
+  if (bump && !TERN0(ENDSTOP_TRIGGER_TIMING, timed_home)) {
     // Move away from the endstop by the axis HOME_BUMP_MM
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Move Away:");
     do_homing_move(axis, -bump
@@ -1611,6 +1684,9 @@ void homeaxis(const AxisEnum axis) {
       if (axis == Z_AXIS) bltouch.stow(); // The final STOW
     #endif
   }
+  #if ENABLED(ENDSTOP_TRIGGER_TIMING) && HOMING_Z_WITH_PROBE && BOTH(BLTOUCH, BLTOUCH_HS_MODE)
+    else if (axis == Z_AXIS) bltouch.stow(); // The final STOW
+  #endif
 
   #if HAS_EXTRA_ENDSTOPS
     const bool pos_dir = axis_home_dir > 0;
@@ -1771,7 +1847,15 @@ void homeaxis(const AxisEnum axis) {
 
   #else // CARTESIAN / CORE
 
+    #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+      // The axis stopped past the edge that marks home
+      const float overshoot = timed_home ? planner.get_axis_position_mm(axis) - planner.triggered_position_mm(axis) : 0;
+    #endif
+
     set_axis_is_at_home(axis);
+    #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+      current_position[axis] += overshoot;
+    #endif
     sync_plan_position();
 
     destination[axis] = current_position[axis];
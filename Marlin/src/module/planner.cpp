@@ -202,6 +202,17 @@ uint32_t Planner::cutoff_long;
 xyze_float_t Planner::previous_speed;
 float Planner::previous_nominal_speed_sqr;
 
+#if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+  int16_t Planner::feedrate_scaled; // = 0
+  int16_t Planner::applied_feedrate_percentage = 100;
+#endif
+
+#if HAS_ARC_JUNCTIONS
+  float Planner::arc_radius, // = 0
+        Planner::arc_jd_ratio;
+  bool Planner::arc_started; // = false
+#endif
+
 #if ENABLED(DISABLE_INACTIVE_EXTRUDER)
   uint8_t Planner::g_uc_extruder_last_move[EXTRUDERS] = { 0 };
 #endif
@@ -1140,7 +1151,7 @@ void Planner::recalculate_trapezoids() {
             const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
                         nomr = 1.0f / current_nominal_speed;
             calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
-            #if ENABLED(LIN_ADVANCE)
+            #if ENABLED(LIN_ADVANCE) && DISABLED(LIN_ADVANCE_SMOOTHING)
               if (block->use_advance_lead) {
                 const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
                 block->max_adv_steps = current_nominal_speed * comp;
@@ -1179,7 +1190,7 @@ void Planner::recalculate_trapezoids() {
       const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
                   nomr = 1.0f / next_nominal_speed;
       calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
-      #if ENABLED(LIN_ADVANCE)
+      #if ENABLED(LIN_ADVANCE) && DISABLED(LIN_ADVANCE_SMOOTHING)
         if (next->use_advance_lead) {
           const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
           next->max_adv_steps = next_nominal_speed * comp;
@@ -1577,7 +1588,11 @@ void Planner::endstop_triggered(const AxisEnum axis) {
 }
 
 float Planner::triggered_position_mm(const AxisEnum axis) {
-  return stepper.triggered_position(axis) * steps_to_mm[axis];
+  return (stepper.triggered_position(axis)
+    #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+      + stepper.triggered_offset(axis)
+    #endif
+  ) * steps_to_mm[axis];
 }
 
 void Planner::finish_and_disable() {
@@ -1615,6 +1630,137 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
   return axis_steps * steps_to_mm[axis];
 }
 
+/**
+ * Replay the trapezoids of the queued blocks to get the time they need.
+ * Nothing is changed. The block being run counts in full.
+ */
+float Planner::get_queued_seconds() {
+  float seconds = 0;
+  for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+    const block_t * const block = &block_buffer[b];
+    const float accel = block->acceleration_steps_per_s2;
+    if (!block->step_event_count || !accel) continue;
+
+    // Without a plateau the peak rate is reached where acceleration stops
+    const float peak = block->decelerate_after > block->accelerate_until
+      ? float(block->nominal_rate)
+      : SQRT(sq(float(block->initial_rate)) + 2 * accel * block->accelerate_until);
+
+    seconds += (peak - block->initial_rate) / accel
+             + (peak - block->final_rate) / accel
+             + float(block->decelerate_after - block->accelerate_until) / block->nominal_rate;
+  }
+  return seconds;
+}
+
+#if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+
+  /**
+   * Apply a changed feedrate_percentage to the blocks already queued, so
+   * the change is felt as soon as the stepper takes the next block.
+   *
+   * The block the stepper may take next is left alone, and so is the entry
+   * speed of the one after it, where replanning starts. The blocks from
+   * there are given their new nominal and junction speeds, never below
+   * the curve of the hardest deceleration from that entry speed. The old
+   * plan could stop at the end of the buffer from above that curve, so
+   * the new one can too, without exceeding the acceleration limits.
+   */
+  void Planner::apply_feedrate_percentage() {
+    if (feedrate_percentage == applied_feedrate_percentage) return;
+
+    const uint8_t head = block_buffer_head, nonbusy = block_buffer_nonbusy;
+    if (nonbusy == head || next_block_index(nonbusy) == head) {
+      applied_feedrate_percentage = feedrate_percentage;
+      return;
+    }
+
+    // Keep the stepper away from the blocks being changed. If it got there first, try later.
+    const uint8_t first_index = next_block_index(nonbusy);
+    block_t * const first = &block_buffer[first_index];
+    if (TEST(first->flag, BLOCK_BIT_SYNC_POSITION)) return;
+    SBI(first->flag, BLOCK_BIT_RECALCULATE);
+    if (stepper.is_block_busy(first)) return;
+
+    float min_entry_sqr = first->entry_speed_sqr, prev_nominal_sqr = 0;
+    #if HAS_SPI_LCD
+      int32_t runtime_change_us = 0;
+    #endif
+    for (uint8_t b = first_index; b != head; b = next_block_index(b)) {
+      block_t * const block = &block_buffer[b];
+      if (TEST(block->flag, BLOCK_BIT_SYNC_POSITION)) continue;
+
+      if (block->feedrate_percentage)
+        block->nominal_speed_sqr = _MIN(block->max_speed_sqr, block->requested_speed_sqr * sq(float(feedrate_percentage) / block->feedrate_percentage));
+      NOLESS(block->nominal_speed_sqr, min_entry_sqr);
+
+      const float nominal_speed = SQRT(block->nominal_speed_sqr);
+      block->nominal_rate = CEIL(block->step_event_count * nominal_speed / block->millimeters);
+
+      // The entry of the first block is kept
+      if (block != first)
+        block->max_entry_speed_sqr = _MAX(min_entry_sqr, _MIN(block->max_junction_speed_sqr, block->nominal_speed_sqr, prev_nominal_sqr));
+
+      const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters);
+      if (block->nominal_speed_sqr <= v_allowable_sqr) SBI(block->flag, BLOCK_BIT_NOMINAL_LENGTH); else CBI(block->flag, BLOCK_BIT_NOMINAL_LENGTH);
+      SBI(block->flag, BLOCK_BIT_RECALCULATE);
+
+      #if HAS_SPI_LCD
+        const uint32_t segment_time_us = LROUND(block->millimeters * 1000000.0f / nominal_speed);
+        runtime_change_us += int32_t(segment_time_us - block->segment_time_us);
+        block->segment_time_us = segment_time_us;
+      #endif
+
+      prev_nominal_sqr = block->nominal_speed_sqr;
+      min_entry_sqr = _MAX(0.0f, min_entry_sqr - 2 * block->acceleration * block->millimeters);
+    }
+
+    #if HAS_SPI_LCD
+      const bool was_enabled = stepper.suspend();
+      block_buffer_runtime_us += runtime_change_us;
+      if (was_enabled) stepper.wake_up();
+    #endif
+
+    // The next block queued joins the last one at its new speed
+    if (prev_nominal_sqr) previous_nominal_speed_sqr = prev_nominal_sqr;
+
+    // Replan from the first block changed
+    block_buffer_planned = first_index;
+    recalculate();
+
+    applied_feedrate_percentage = feedrate_percentage;
+  }
+
+#endif // QUEUED_FEEDRATE_OVERRIDE
+
+#if HAS_ARC_JUNCTIONS
+
+  /**
+   * Start an arc whose chords each turn by chord_angle. Between two chords
+   * the junction angle is 180° - chord_angle, so the junction deviation
+   * radius is JD * cos(chord_angle/2) / (1 - cos(chord_angle/2)).
+   */
+  void Planner::begin_arc(const float &radius, const float &chord_angle) {
+    const float half_turn = ABS(chord_angle) * 0.5f,
+                one_minus_cos = 2 * sq(sin(half_turn * 0.5f)); // 1 - cos(half_turn) without cancellation
+    arc_radius = radius;
+    arc_jd_ratio = one_minus_cos > 0 ? cos(half_turn) / one_minus_cos : 1e9f;
+    arc_started = false;
+  }
+
+  void Planner::idle_outside_arc() {
+    const float radius = arc_radius;
+    const bool started = arc_started;
+    const uint8_t head = block_buffer_head;
+    arc_radius = 0;
+    arc_started = false;
+    idle();
+    arc_radius = radius;
+    arc_started = started && block_buffer_head == head; // A move queued meanwhile ends the run of arc junctions
+  }
+
+#endif
+
 /**
  * Block until all buffered steps are executed / cleaned
  */
@@ -1624,6 +1770,9 @@ void Planner::synchronize() {
     #if ENABLED(EXTERNAL_CLOSED_LOOP_CONTROLLER)
       || (READ(CLOSED_LOOP_ENABLE_PIN) && !READ(CLOSED_LOOP_MOVE_COMPLETE_PIN))
     #endif
+    #if ENABLED(INPUT_SHAPING)
+      || stepper.shaping_busy()
+    #endif
   ) idle();
 }
 
@@ -1647,7 +1796,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   #if HAS_DIST_MM_ARG
     , const xyze_float_t &cart_dist_mm
   #endif
-  , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters
+  , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters, const bool replan
 ) {
 
   // If we are cleaning, do not accept queuing of movements
@@ -1686,7 +1835,7 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   block_buffer_head = next_buffer_head;
 
   // Recalculate and optimize trapezoidal speed profiles
-  recalculate();
+  if (replan) recalculate();
 
   // Movement successfully queued!
   return true;
@@ -1900,17 +2049,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
         #endif
       );
 
-    /**
-     * At this point at least one of the axes has more steps than
-     * MIN_STEPS_PER_SEGMENT, ensuring the segment won't get dropped as
-     * zero-length. It's important to not apply corrections
-     * to blocks that would get dropped!
-     *
-     * A correction function is permitted to add steps to an axis, it
-     * should *never* remove steps!
-     */
+    // Keep the slack in steps up to date for the Stepper ISR to take up
     #if ENABLED(BACKLASH_COMPENSATION)
-      backlash.add_correction_steps(da, db, dc, dm, block);
+      backlash.update_correction_steps();
     #endif
   }
 
@@ -2075,12 +2216,23 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   xyze_float_t current_speed;
   float speed_factor = 1.0f; // factor <1 decreases speed
 
+  #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+    float max_speed_factor = 1e6f; // factor to reach the first axis limit
+    block->feedrate_percentage = feedrate_scaled;
+    block->requested_speed_sqr = block->nominal_speed_sqr;
+    // A move scaled before the latest change has idle() rescale it with the others
+    if (feedrate_scaled && feedrate_scaled != feedrate_percentage) applied_feedrate_percentage = 0;
+  #endif
+
   // Linear axes first with less logic
   LOOP_XYZ(i) {
     current_speed[i] = steps_dist_mm[i] * inverse_secs;
     const feedRate_t cs = ABS(current_speed[i]),
                  max_fr = settings.max_feedrate_mm_s[i];
     if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
+    #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+      if (cs) NOMORE(max_speed_factor, max_fr / cs);
+    #endif
   }
 
   // Limit speed on extruders, if any
@@ -2099,6 +2251,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
                               #endif
                             );
       if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
+      #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+        if (cs) NOMORE(max_speed_factor, max_fr / cs);
+      #endif
     }
   #endif
 
@@ -2147,6 +2302,10 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     block->nominal_speed_sqr = block->nominal_speed_sqr * sq(speed_factor);
   }
 
+  #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+    block->max_speed_sqr = block->requested_speed_sqr * sq(speed_factor < 1.0f ? speed_factor : max_speed_factor);
+  #endif
+
   // Compute and limit the acceleration rate for the trapezoid generator.
   const float steps_per_mm = block->step_event_count * inverse_millimeters;
   uint32_t accel;
@@ -2216,6 +2375,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
         // This assumes no one will use a retract length of 0mm < retr_length < ~0.2mm and no one will print 100mm wide lines using 3mm filament or 35mm wide lines using 1.75mm filament.
         if (block->e_D_ratio > 3.0f)
           block->use_advance_lead = false;
+        #if DISABLED(LIN_ADVANCE_SMOOTHING)
         else {
           const uint32_t max_accel_steps_per_s2 = MAX_E_JERK / (extruder_advance_K[active_extruder] * block->e_D_ratio) * steps_per_mm;
           #if ENABLED(LA_DEBUG)
@@ -2223,6 +2383,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
           #endif
           NOMORE(accel, max_accel_steps_per_s2);
         }
+        #endif
       }
     #endif
 
@@ -2251,7 +2412,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = (uint32_t)(accel * (4096.0f * 4096.0f / (STEPPER_TIMER_RATE)));
   #endif
-  #if ENABLED(LIN_ADVANCE)
+  #if ENABLED(LIN_ADVANCE_SMOOTHING)
+    // The smoothed advance follows the step rate, so it needs no E jerk limit
+    if (block->use_advance_lead)
+      block->advance_rate = extruder_advance_K[active_extruder] * block->steps.e / block->step_event_count * 16777216.0f;
+  #elif ENABLED(LIN_ADVANCE)
     if (block->use_advance_lead) {
       block->advance_speed = (STEPPER_TIMER_RATE) / (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
       #if ENABLED(LA_DEBUG)
@@ -2303,6 +2468,8 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     // Unit vector of previous path line segment
     static xyze_float_t prev_unit_vec;
 
+    #define SAME_XYZE(A,B) (A.x == B.x && A.y == B.y && A.z == B.z && A.e == B.e)
+
     xyze_float_t unit_vec =
       #if HAS_DIST_MM_ARG
         cart_dist_mm
@@ -2323,13 +2490,48 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
     // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
     if (moves_queued && !UNEAR_ZERO(previous_nominal_speed_sqr)) {
+      // Segments of a straight line usually get identical unit vectors. The junction between
+      // two of them only depends on the direction, acceleration and length, so the last such
+      // junction can be reused. This saves three square roots per segment when segmenting.
+      // The key includes junction_deviation_mm, which M205 J may change between segments,
+      // and the acceleration allowed by the axes of the line, which M201 may change.
+      static xyze_float_t straight_unit_vec;
+      static float straight_acceleration, straight_axis_acceleration, straight_millimeters,
+                   straight_junction_deviation, straight_vmax_junction_sqr;
+      const bool straight = SAME_XYZE(unit_vec, prev_unit_vec);
+      const float axis_acceleration = straight ? limit_value_by_axis_maximum(block->acceleration, unit_vec) : 0;
+
       // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
       // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
       float junction_cos_theta = (-prev_unit_vec.x * unit_vec.x) + (-prev_unit_vec.y * unit_vec.y)
                                + (-prev_unit_vec.z * unit_vec.z) + (-prev_unit_vec.e * unit_vec.e);
 
+      #if HAS_ARC_JUNCTIONS
+        // Between two segments of an arc the path follows the circle, so the
+        // junction speed is limited by the centripetal acceleration on the arc.
+        // Junction deviation still bounds the turn between the two chords.
+        // The centripetal acceleration points along the change of direction,
+        // so each axis limits it as in any other junction.
+        if (arc_started) {
+          float junction_acceleration = block->acceleration;
+          if (!straight) {
+            xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
+            normalize_junction_vector(junction_unit_vec);
+            junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec);
+          }
+          vmax_junction_sqr = junction_acceleration * _MIN(arc_radius, junction_deviation_mm * arc_jd_ratio);
+        }
+        else
+      #endif
+      if (straight && SAME_XYZE(unit_vec, straight_unit_vec)
+        && block->acceleration == straight_acceleration && axis_acceleration == straight_axis_acceleration
+        && block->millimeters == straight_millimeters
+        && junction_deviation_mm == straight_junction_deviation
+      )
+        vmax_junction_sqr = straight_vmax_junction_sqr;
+
       // NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
-      if (junction_cos_theta > 0.999999f) {
+      else if (junction_cos_theta > 0.999999f) {
         // For a 0 degree acute junction, just set minimum junction speed.
         vmax_junction_sqr = sq(float(MINIMUM_PLANNER_SPEED));
       }
@@ -2355,16 +2557,31 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
             NOMORE(vmax_junction_sqr, limit_sqr);
           }
         }
+
+        if (straight) {
+          straight_unit_vec = unit_vec;
+          straight_acceleration = block->acceleration;
+          straight_axis_acceleration = axis_acceleration;
+          straight_millimeters = block->millimeters;
+          straight_junction_deviation = junction_deviation_mm;
+          straight_vmax_junction_sqr = vmax_junction_sqr;
+        }
       }
 
+      #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+        block->max_junction_speed_sqr = vmax_junction_sqr;
+      #endif
+
       // Get the lowest speed
       vmax_junction_sqr = _MIN(vmax_junction_sqr, block->nominal_speed_sqr, previous_nominal_speed_sqr);
     }
     else // Init entry speed to zero. Assume it starts from rest. Planner will correct this later.
-      vmax_junction_sqr = 0;
+      vmax_junction_sqr = TERN_(QUEUED_FEEDRATE_OVERRIDE, block->max_junction_speed_sqr =) 0;
 
     prev_unit_vec = unit_vec;
 
+    #undef SAME_XYZE
+
   #endif
 
   #ifdef USE_CACHED_SQRT
@@ -2480,6 +2697,11 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
       vmax_junction_sqr = sq(vmax_junction);
     #endif
 
+    // Jerk limits depend on the nominal speeds. Keep them as they are.
+    #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+      block->max_junction_speed_sqr = vmax_junction_sqr;
+    #endif
+
   #endif // Classic Jerk Limiting
 
   // Max entry speed of this block equals the max exit speed of the previous block.
@@ -2502,6 +2724,10 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   // the maximum junction speed and may always be ignored for any speed reduction checks.
   block->flag |= block->nominal_speed_sqr <= v_allowable_sqr ? BLOCK_FLAG_RECALCULATE | BLOCK_FLAG_NOMINAL_LENGTH : BLOCK_FLAG_RECALCULATE;
 
+  #if HAS_ARC_JUNCTIONS
+    if (arc_radius) arc_started = true;
+  #endif
+
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
   previous_nominal_speed_sqr = block->nominal_speed_sqr;
@@ -2571,7 +2797,7 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
   #if HAS_DIST_MM_ARG
     , const xyze_float_t &cart_dist_mm
   #endif
-  , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/
+  , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters/*=0.0*/, const bool replan/*=true*/
 ) {
 
   // If we are cleaning, do not accept queuing of movements
@@ -2650,11 +2876,12 @@ bool Planner::buffer_segment(const float &a, const float &b, const float &c, con
       #if HAS_DIST_MM_ARG
         , cart_dist_mm
       #endif
-      , fr_mm_s, extruder, millimeters
+      , fr_mm_s, extruder, millimeters, replan
     )
   ) return false;
 
-  stepper.wake_up();
+  // A batch wakes the stepper once it has been planned
+  if (replan) stepper.wake_up();
   return true;
 } // buffer_segment()
 
@@ -2674,20 +2901,77 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
     , const float &inv_duration
   #endif
 ) {
-  xyze_pos_t machine = { rx, ry, rz, e };
+  return _buffer_line(xyze_pos_t({ rx, ry, rz, e }), fr_mm_s, extruder, millimeters
+    #if ENABLED(SCARA_FEEDRATE_SCALING)
+      , inv_duration
+    #endif
+    , true, true
+  );
+} // buffer_line()
+
+/**
+ * Add a batch of linear movements to the buffer, replanning once at the end.
+ *
+ * The new blocks are marked for recalculation, so the Stepper won't start
+ * them until the batch is planned. If the buffer fills up along the way
+ * plan what's there first, so the Stepper can free up more blocks.
+ */
+uint8_t Planner::buffer_segments(const xyze_pos_t cart[], const uint8_t count, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters
+  #if ENABLED(SCARA_FEEDRATE_SCALING)
+    , const float &inv_duration
+  #endif
+  #if HAS_LEVELING
+    , const bool leveled
+  #endif
+) {
+  #if !HAS_LEVELING
+    constexpr bool leveled = false;
+  #endif
+  uint8_t n = 0;
+  for (; n < count; n++) {
+    if (!moves_free()) { recalculate(); stepper.wake_up(); }
+    if (!_buffer_line(cart[n], fr_mm_s, extruder, millimeters
+      #if ENABLED(SCARA_FEEDRATE_SCALING)
+        , inv_duration
+      #endif
+      , !leveled, false
+    )) break;
+  }
+  if (n) {
+    recalculate();
+    stepper.wake_up();
+  }
+  return n;
+} // buffer_segments()
+
+/**
+ * The common part of buffer_line and buffer_segments.
+ *
+ *  level  - apply bed leveling with the other position modifiers
+ *  replan - recalculate the trapezoids after adding the block
+ */
+bool Planner::_buffer_line(const xyze_pos_t &cart, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters
+  #if ENABLED(SCARA_FEEDRATE_SCALING)
+    , const float &inv_duration
+  #endif
+  , const bool level, const bool replan
+) {
+  UNUSED(level);
+  xyze_pos_t machine = cart;
   #if HAS_POSITION_MODIFIERS
-    apply_modifiers(machine);
+    apply_modifiers(machine
+      #if HAS_LEVELING
+        , level && ENABLED(PLANNER_LEVELING)
+      #endif
+    );
   #endif
 
   #if IS_KINEMATIC
 
     #if DISABLED(CLASSIC_JERK)
-      const xyze_pos_t cart_dist_mm = {
-        rx - position_cart.x, ry - position_cart.y,
-        rz - position_cart.z, e  - position_cart.e
-      };
+      const xyze_pos_t cart_dist_mm = cart - position_cart;
     #else
-      const xyz_pos_t cart_dist_mm = { rx - position_cart.x, ry - position_cart.y, rz - position_cart.z };
+      const xyz_pos_t cart_dist_mm = { cart.x - position_cart.x, cart.y - position_cart.y, cart.z - position_cart.z };
     #endif
 
     float mm = millimeters;
@@ -2710,17 +2994,17 @@ bool Planner::buffer_line(const float &rx, const float &ry, const float &rz, con
       #if DISABLED(CLASSIC_JERK)
         , cart_dist_mm
       #endif
-      , feedrate, extruder, mm
+      , feedrate, extruder, mm, replan
     )) {
-      position_cart.set(rx, ry, rz, e);
+      position_cart = cart;
       return true;
     }
     else
       return false;
   #else
-    return buffer_segment(machine, fr_mm_s, extruder, millimeters);
+    return buffer_segment(machine, fr_mm_s, extruder, millimeters, replan);
   #endif
-} // buffer_line()
+}
 
 /**
  * Directly set the planner ABC position (and stepper positions)
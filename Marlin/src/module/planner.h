@@ -143,9 +143,13 @@ typedef struct block_t {
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
     bool use_advance_lead;
-    uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
-             max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
-             final_adv_steps;               // advance steps due to exit speed
+    #if ENABLED(LIN_ADVANCE_SMOOTHING)
+      uint32_t advance_rate;                // E steps of advance per step/s, times 2^24
+    #else
+      uint16_t advance_speed,               // STEP timer value for extruder speed offset ISR
+               max_adv_steps,               // max. advance steps to get cruising speed pressure (not always nominal_speed!)
+               final_adv_steps;             // advance steps due to exit speed
+    #endif
     float e_D_ratio;
   #endif
 
@@ -174,12 +178,26 @@ typedef struct block_t {
     uint32_t sdpos;
   #endif
 
+  #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+    int16_t feedrate_percentage;            // Feedrate percentage the block was planned with. 0 if not scaled.
+    float requested_speed_sqr,              // Nominal speed asked for, at that percentage, in (mm/sec)^2
+          max_speed_sqr,                    // Highest nominal speed allowed by the axis limits in (mm/sec)^2
+          max_junction_speed_sqr;           // Junction speed limit before the nominal speed limits in (mm/sec)^2
+  #endif
+
 } block_t;
 
 #define HAS_POSITION_FLOAT ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL)
 
+// Segments of an arc join at the speed the arc itself allows
+#define HAS_ARC_JUNCTIONS (ENABLED(ARC_SUPPORT) && DISABLED(CLASSIC_JERK))
+
 #define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
 
+// The most segments to hand to Planner::buffer_segments at once.
+// Unplanned blocks can't be executed, so leave plenty of planned ones.
+#define SEGMENT_BATCH_SIZE ((BLOCK_BUFFER_SIZE) >= 16 ? 8 : (BLOCK_BUFFER_SIZE) / 2)
+
 typedef struct {
    uint32_t max_acceleration_mm_per_s2[XYZE_N], // (mm/s^2) M201 XYZE
             min_segment_time_us;                // (µs) M205 B
@@ -258,6 +276,10 @@ class Planner {
     static uint32_t max_acceleration_steps_per_s2[XYZE_N]; // (steps/s^2) Derived from mm_per_s2
     static float steps_to_mm[XYZE_N];           // Millimeters per step
 
+    #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+      static int16_t feedrate_scaled;           // Percentage the moves being queued were scaled by. 0 if not scaled.
+    #endif
+
     #if DISABLED(CLASSIC_JERK)
       static float junction_deviation_mm;       // (mm) M205 J
       #if ENABLED(LIN_ADVANCE)
@@ -325,6 +347,16 @@ class Planner {
      */
     static float previous_nominal_speed_sqr;
 
+    #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+      static int16_t applied_feedrate_percentage;
+    #endif
+
+    #if HAS_ARC_JUNCTIONS
+      static float arc_radius,      // (mm) Radius of the arc being queued, 0 if none
+                   arc_jd_ratio;    // Junction radius per mm of junction deviation at the arc's chord angle
+      static bool arc_started;      // A segment of the arc has been queued
+    #endif
+
     /**
      * Limit where 64bit math is necessary for acceleration calculation
      */
@@ -569,7 +601,13 @@ class Planner {
     FORCE_INLINE static block_t* get_next_free_block(uint8_t &next_buffer_head, const uint8_t count=1) {
 
       // Wait until there are enough slots free
-      while (moves_free() < count) { idle(); }
+      while (moves_free() < count) {
+        #if HAS_ARC_JUNCTIONS
+          idle_outside_arc();
+        #else
+          idle();
+        #endif
+      }
 
       // Return the first available block
       next_buffer_head = next_block_index(block_buffer_head);
@@ -585,6 +623,7 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  replan      - recalculate the trapezoids (false to defer to the caller)
      *
      * Returns true if movement was buffered, false otherwise
      */
@@ -595,7 +634,7 @@ class Planner {
       #if HAS_DIST_MM_ARG
         , const xyze_float_t &cart_dist_mm
       #endif
-      , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      , feedRate_t fr_mm_s, const uint8_t extruder, const float &millimeters=0.0, const bool replan=true
     );
 
     /**
@@ -645,25 +684,26 @@ class Planner {
      *  fr_mm_s     - (target) speed of the move
      *  extruder    - target extruder
      *  millimeters - the length of the movement, if known
+     *  replan      - recalculate the trapezoids (false to defer to the caller)
      */
     static bool buffer_segment(const float &a, const float &b, const float &c, const float &e
       #if HAS_DIST_MM_ARG
         , const xyze_float_t &cart_dist_mm
       #endif
-      , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters=0.0, const bool replan=true
     );
 
     FORCE_INLINE static bool buffer_segment(abce_pos_t &abce
       #if HAS_DIST_MM_ARG
         , const xyze_float_t &cart_dist_mm
       #endif
-      , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters=0.0
+      , const feedRate_t &fr_mm_s, const uint8_t extruder, const float &millimeters=0.0, const bool replan=true
     ) {
       return buffer_segment(abce.a, abce.b, abce.c, abce.e
         #if HAS_DIST_MM_ARG
           , cart_dist_mm
         #endif
-        , fr_mm_s, extruder, millimeters);
+        , fr_mm_s, extruder, millimeters, replan);
     }
 
   public:
@@ -697,6 +737,41 @@ class Planner {
       );
     }
 
+  private:
+
+    static bool _buffer_line(const xyze_pos_t &cart, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters
+      #if ENABLED(SCARA_FEEDRATE_SCALING)
+        , const float &inv_duration
+      #endif
+      , const bool level, const bool replan
+    );
+
+  public:
+
+    /**
+     * Add a batch of linear movements to the buffer.
+     * The targets are cartesian, as for buffer_line, but the trapezoids
+     * are only recalculated once for the whole batch.
+     *
+     *  cart         - target positions in mm or degrees
+     *  count        - number of targets, at most SEGMENT_BATCH_SIZE
+     *  fr_mm_s      - (target) speed of the moves (mm/s)
+     *  extruder     - target extruder
+     *  millimeters  - the length of each movement, if known
+     *  inv_duration - the reciprocal of the duration of each movement, if known (SCARA feedrate scaling)
+     *  leveled      - the targets already include the bed leveling correction
+     *
+     * Returns the number of targets that were buffered.
+     */
+    static uint8_t buffer_segments(const xyze_pos_t cart[], const uint8_t count, const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters=0.0
+      #if ENABLED(SCARA_FEEDRATE_SCALING)
+        , const float &inv_duration=0.0
+      #endif
+      #if HAS_LEVELING
+        , const bool leveled=false
+      #endif
+    );
+
     /**
      * Set the planner.position and individual stepper positions.
      * Used by G92, G28, G29, and other procedures.
@@ -757,6 +832,22 @@ class Planner {
     // Block until all buffered steps are executed / cleaned
     static void synchronize();
 
+    // Time to run the queued blocks, from their trapezoids
+    static float get_queued_seconds();
+
+    #if ENABLED(QUEUED_FEEDRATE_OVERRIDE)
+      // Replan the queued blocks for a changed feedrate_percentage
+      static void apply_feedrate_percentage();
+    #endif
+
+    #if HAS_ARC_JUNCTIONS
+      // Mark the segments queued in between as parts of one arc, each turning by chord_angle
+      static void begin_arc(const float &radius, const float &chord_angle);
+      FORCE_INLINE static void end_arc() { arc_radius = 0; }
+      // Call idle() with the arc set aside, so moves it queues aren't taken for arc segments
+      static void idle_outside_arc();
+    #endif
+
     // Wait for moves to finish and disable all steppers
     static void finish_and_disable();
 
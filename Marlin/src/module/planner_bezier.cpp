@@ -42,70 +42,53 @@
 // See the meaning in the documentation of cubic_b_spline().
 #define MIN_STEP 0.002f
 #define MAX_STEP 0.1f
-#define SIGMA 0.1f
+#ifndef BEZIER_MAX_DEVIATION
+  #define BEZIER_MAX_DEVIATION 0.05f
+#endif
 
 // Compute the linear interpolation between two real numbers.
 static inline float interp(const float &a, const float &b, const float &t) { return (1 - t) * a + t * b; }
 
 /**
- * Compute a Bézier curve using the De Casteljau's algorithm (see
- * https://en.wikipedia.org/wiki/De_Casteljau%27s_algorithm), which is
- * easy to code and has good numerical stability (very important,
- * since Arudino works with limited precision real numbers).
+ * The curve is taken in power form, B(t) = ((a t + b) t + c) t + d, so a
+ * point costs three multiply-adds per axis. Its second derivative is linear
+ * in t, so over any interval its largest size is at one of the two ends.
  */
-static inline float eval_bezier(const float &a, const float &b, const float &c, const float &d, const float &t) {
-  const float iab = interp(a, b, t),
-              ibc = interp(b, c, t),
-              icd = interp(c, d, t),
-              iabc = interp(iab, ibc, t),
-              ibcd = interp(ibc, icd, t);
-  return interp(iabc, ibcd, t);
-}
+struct bezier_t {
+  xy_pos_t a, b, c, d,    // Power form coefficients
+           dd0, dd1;      // Second derivative at t = 0 and t = 1
+
+  bezier_t(const xy_pos_t &p0, const xy_pos_t &p1, const xy_pos_t &p2, const xy_pos_t &p3) {
+    d = p0;
+    c = (p1 - p0) * 3;
+    b = (p2 - p1 * 2 + p0) * 3;
+    a = p3 - p0 + (p1 - p2) * 3;
+    dd0 = (p2 - p1 * 2 + p0) * 6;
+    dd1 = (p3 - p2 * 2 + p1) * 6;
+  }
 
-/**
- * We approximate Euclidean distance with the sum of the coordinates
- * offset (so-called "norm 1"), which is quicker to compute.
- */
-static inline float dist1(const float &x1, const float &y1, const float &x2, const float &y2) { return ABS(x1 - x2) + ABS(y1 - y2); }
+  xy_pos_t point(const float &t) const { return ((a * t + b) * t + c) * t + d; }
+
+  // Squared size of the second derivative at t
+  float dd_sqr(const float &t) const {
+    const xy_pos_t dd = dd0 + (dd1 - dd0) * t;
+    return sq(dd.x) + sq(dd.y);
+  }
+};
 
 /**
- * The algorithm for computing the step is loosely based on the one in Kig
- * (See https://sources.debian.net/src/kig/4:15.08.3-1/misc/kigpainter.cpp/#L759)
- * However, we do not use the stack.
- *
- * The algorithm goes as it follows: the parameters t runs from 0.0 to
- * 1.0 describing the curve, which is evaluated by eval_bezier(). At
- * each iteration we have to choose a step, i.e., the increment of the
- * t variable. By default the step of the previous iteration is taken,
- * and then it is enlarged or reduced depending on how straight the
- * curve locally is. The step is always clamped between MIN_STEP/2 and
- * 2*MAX_STEP. MAX_STEP is taken at the first iteration.
- *
- * For some t, the step value is considered acceptable if the curve in
- * the interval [t, t+step] is sufficiently straight, i.e.,
- * sufficiently close to linear interpolation. In practice the
- * following test is performed: the distance between eval_bezier(...,
- * t+step/2) is evaluated and compared with 0.5*(eval_bezier(...,
- * t)+eval_bezier(..., t+step)). If it is smaller than SIGMA, then the
- * step value is considered acceptable, otherwise it is not. The code
- * seeks to find the larger step value which is considered acceptable.
+ * Flatten the curve into chords that stay within BEZIER_MAX_DEVIATION of it.
  *
- * At every iteration the recorded step value is considered and then
- * iteratively halved until it becomes acceptable. If it was already
- * acceptable in the beginning (i.e., no halving were done), then
- * maybe it was necessary to enlarge it; then it is iteratively
- * doubled while it remains acceptable. The last acceptable value
- * found is taken, provided that it is between MIN_STEP and MAX_STEP
- * and does not bring t over 1.0.
+ * A chord over a step h of t is never farther from the curve than h^2/8
+ * times the largest second derivative over that step. Each step is sized
+ * from the second derivative where it starts, then shortened once if the
+ * end of the step bends more, so the bound holds over the whole step.
+ * Flat stretches get long chords and tight bends get short ones, with one
+ * point evaluation per chord and no trial points.
  *
- * Caveat: this algorithm is not perfect, since it can happen that a
- * step is considered acceptable even when the curve is not linear at
- * all in the interval [t, t+step] (but its mid point coincides "by
- * chance" with the midpoint according to the parametrization). This
- * kind of glitches can be eliminated with proper first derivative
- * estimates; however, given the improbability of such configurations,
- * the mitigation offered by MIN_STEP and the small computational
- * power available on Arduino, I think it is not wise to implement it.
+ * The step is kept between MIN_STEP, so a curve never makes more segments
+ * than the planner can be fed, and MAX_STEP, so long flat curves still get
+ * a few points for Z and E.
  */
 void cubic_b_spline(
   const xyze_pos_t &position,       // current position
@@ -114,92 +97,56 @@ void cubic_b_spline(
   const feedRate_t &scaled_fr_mm_s, // mm/s scaled by feedrate %
   const uint8_t extruder
 ) {
-  // Absolute first and second control points are recovered.
-  const xy_pos_t first = position + offsets[0], second = target + offsets[1];
+  const bezier_t curve(position, position + offsets[0], target + offsets[1], target);
 
-  xyze_pos_t bez_target;
-  bez_target.set(position.x, position.y);
-  float step = MAX_STEP;
+  // h^2 / 8 * |B''| <= deviation  =>  h^2 <= 8 * deviation / |B''|
+  constexpr float step_factor = 8 * (BEZIER_MAX_DEVIATION);
+  auto step_for = [&](const float &dd_sqr) {
+    return dd_sqr > sq(step_factor / sq(MAX_STEP)) ? SQRT(step_factor / SQRT(dd_sqr)) : MAX_STEP;
+  };
 
   millis_t next_idle_ms = millis() + 200UL;
 
-  for (float t = 0; t < 1;) {
-
-    thermalManager.manage_heater();
-    millis_t now = millis();
-    if (ELAPSED(now, next_idle_ms)) {
-      next_idle_ms = now + 200UL;
-      idle();
-    }
-
-    // First try to reduce the step in order to make it sufficiently
-    // close to a linear interpolation.
-    bool did_reduce = false;
-    float new_t = t + step;
-    NOMORE(new_t, 1);
-    float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
-          new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
-    for (;;) {
-      if (new_t - t < (MIN_STEP)) break;
-      const float candidate_t = 0.5f * (t + new_t),
-                  candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + new_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + new_pos1);
-      if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-      did_reduce = true;
-    }
-
-    // If we did not reduce the step, maybe we should enlarge it.
-    if (!did_reduce) for (;;) {
-      if (new_t - t > MAX_STEP) break;
-      const float candidate_t = t + 2 * (new_t - t);
-      if (candidate_t >= 1) break;
-      const float candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
-      if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-    }
+  // Segments are handed to the planner in batches. They vary in length, so the planner
+  // works out the length of each one.
+  xyze_pos_t batch[SEGMENT_BATCH_SIZE];
+  uint8_t count = 0;
 
-    // Check some postcondition; they are disabled in the actual
-    // Marlin build, but if you test the same code on a computer you
-    // may want to check they are respect.
-    /*
-      assert(new_t <= 1.0);
-      if (new_t < 1.0) {
-        assert(new_t - t >= (MIN_STEP) / 2.0);
-        assert(new_t - t <= (MAX_STEP) * 2.0);
-      }
-    */
+  float dd_sqr = curve.dd_sqr(0);
+  for (float t = 0; t < 1;) {
 
-    step = new_t - t;
-    t = new_t;
+    float step = step_for(dd_sqr);
+    // The end of the step may bend more than its start. That includes the last chord.
+    const float end_dd_sqr = curve.dd_sqr(_MIN(t + step, 1.0f));
+    if (end_dd_sqr > dd_sqr) step = step_for(end_dd_sqr);
+    NOLESS(step, MIN_STEP);
+    t += step;
+    NOMORE(t, 1);
+    dd_sqr = curve.dd_sqr(t);
 
     // Compute and send new position
-    xyze_pos_t new_bez = {
-      new_pos0, new_pos1,
+    const xy_pos_t p = curve.point(t);
+    xyze_pos_t &pos = batch[count++];
+    pos.set(p.x, p.y,
       interp(position.z, target.z, t),   // FIXME. These two are wrong, since the parameter t is
       interp(position.e, target.e, t)    // not linear in the distance.
-    };
-    apply_motion_limits(new_bez);
-    bez_target = new_bez;
-
+    );
+    if (t >= 1) pos = target;            // End exactly at the target
+    apply_motion_limits(pos);
     #if HAS_LEVELING && !PLANNER_LEVELING
-      xyze_pos_t pos = bez_target;
       planner.apply_leveling(pos);
-    #else
-      const xyze_pos_t &pos = bez_target;
     #endif
 
-    if (!planner.buffer_line(pos, scaled_fr_mm_s, active_extruder, step))
-      break;
+    if (count == SEGMENT_BATCH_SIZE || t >= 1) {
+      thermalManager.manage_heater();
+      const millis_t now = millis();
+      if (ELAPSED(now, next_idle_ms)) {
+        next_idle_ms = now + 200UL;
+        idle();
+      }
+      if (planner.buffer_segments(batch, count, scaled_fr_mm_s, active_extruder) < count) break;
+      count = 0;
+    }
   }
 }
 
@@ -48,7 +48,7 @@
   #include "delta.h"
 #endif
 
-#if ENABLED(BABYSTEP_ZPROBE_OFFSET)
+#if ANY(BABYSTEP_ZPROBE_OFFSET, ENDSTOP_TRIGGER_TIMING, PIPELINED_PROBING)
   #include "planner.h"
 #endif
 
@@ -88,6 +88,15 @@ Probe probe;
 
 xyz_pos_t Probe::offset; // Initialized by settings.load()
 
+#if ENABLED(ENDSTOP_TRIGGER_TIMING)
+  float Probe::overshoot;
+#endif
+
+#if ENABLED(PIPELINED_PROBING)
+  bool Probe::pipelined; // = false
+  float Probe::expected_z = NAN, Probe::approach_z = NAN;
+#endif
+
 #if HAS_PROBE_XY_OFFSET
   const xyz_pos_t &Probe::offset_xy = Probe::offset;
 #endif
@@ -443,6 +452,13 @@ bool Probe::set_deployed(const bool deploy) {
   }
 #endif
 
+// The height where the probe triggered
+#if ENABLED(ENDSTOP_TRIGGER_TIMING)
+  #define TRIGGERED_Z (current_position.z - overshoot)
+#else
+  #define TRIGGERED_Z current_position.z
+#endif
+
 /**
  * @brief Used by run_z_probe to do a single Z probe move.
  *
@@ -529,9 +545,28 @@ bool Probe::probe_down_to_z(const float z, const feedRate_t fr_mm_s) {
   // Get Z where the steppers were interrupted
   set_current_from_steppers_for_axis(Z_AXIS);
 
+  #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+    // The steppers went on past the trigger until it was seen
+    overshoot = probe_triggered ? planner.get_axis_position_mm(Z_AXIS) - planner.triggered_position_mm(Z_AXIS) : 0;
+  #endif
+
   // Tell the planner where we actually are
   sync_plan_position();
 
+  #if ENABLED(PIPELINED_PROBING)
+    // A trigger above the end of the queued descent came at the fast speed.
+    // Back off and make this stroke again from a standstill.
+    if (!isnan(approach_z)) {
+      const float az = approach_z;
+      approach_z = NAN;
+      if (probe_triggered && TRIGGERED_Z > az - 0.5f * planner.steps_to_mm[Z_AXIS]) {
+        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Tripped on approach");
+        do_blocking_move_to_z(current_position.z + Z_CLEARANCE_MULTI_PROBE, MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+        return probe_down_to_z(z, fr_mm_s);
+      }
+    }
+  #endif
+
   if (DEBUGGING(LEVELING)) DEBUG_POS("<<< Probe::probe_down_to_z", current_position);
 
   return !probe_triggered;
@@ -558,7 +593,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
     // Do a first probe at the fast speed
     if (probe_down_to_z(z_probe_low_point, MMM_TO_MMS(Z_PROBE_SPEED_FAST))         // No probe trigger?
-      || (sanity_check && current_position.z > -offset.z + _MAX(Z_CLEARANCE_BETWEEN_PROBES, 4) / 2)  // Probe triggered too high?
+      || (sanity_check && TRIGGERED_Z > -offset.z + _MAX(Z_CLEARANCE_BETWEEN_PROBES, 4) / 2)  // Probe triggered too high?
     ) {
       if (DEBUGGING(LEVELING)) {
         DEBUG_ECHOLNPGM("FAST Probe fail!");
@@ -567,7 +602,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
       return NAN;
     }
 
-    const float first_probe_z = current_position.z;
+    const float first_probe_z = TRIGGERED_Z;
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("1st Probe Z:", first_probe_z);
 
@@ -603,7 +638,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
     {
       // Probe downward slowly to find the bed
       if (probe_down_to_z(z_probe_low_point, MMM_TO_MMS(Z_PROBE_SPEED_SLOW))      // No probe trigger?
-        || (sanity_check && current_position.z > -offset.z + _MAX(Z_CLEARANCE_MULTI_PROBE, 4) / 2)  // Probe triggered too high?
+        || (sanity_check && TRIGGERED_Z > -offset.z + _MAX(Z_CLEARANCE_MULTI_PROBE, 4) / 2)  // Probe triggered too high?
       ) {
         if (DEBUGGING(LEVELING)) {
           DEBUG_ECHOLNPGM("SLOW Probe fail!");
@@ -616,7 +651,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
         backlash.measure_with_probe();
       #endif
 
-      const float z = current_position.z;
+      const float z = TRIGGERED_Z;
 
       #if EXTRA_PROBING
         // Insert Z measurement into probes[]. Keep it sorted ascending.
@@ -667,7 +702,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
   #elif TOTAL_PROBING == 2
 
-    const float z2 = current_position.z;
+    const float z2 = TRIGGERED_Z;
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("2nd Probe Z:", z2, " Discrepancy:", first_probe_z - z2);
 
@@ -677,7 +712,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
   #else
 
     // Return the single probe result
-    const float measured_z = current_position.z;
+    const float measured_z = TRIGGERED_Z;
 
   #endif
 
@@ -734,14 +769,46 @@ float Probe::probe_at_point(const float &rx, const float &ry, const ProbePtRaise
   feedrate_mm_s = XY_PROBE_FEEDRATE_MM_S;
 
   // Move the probe to the starting XYZ
-  do_blocking_move_to(npos);
+  #if ENABLED(PIPELINED_PROBING)
+    if (pipelined && !isnan(expected_z)) {
+      // Queue the travel and a fast descent to just above the expected bed.
+      // The probing stroke follows on without a stop.
+      current_position.set(npos.x, npos.y);
+      line_to_current_position(XY_PROBE_FEEDRATE_MM_S);
+      const float az = expected_z - offset.z + (PIPELINED_PROBING_MARGIN);
+      if (az < current_position.z) {
+        current_position.z = approach_z = az;
+        line_to_current_position(MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      }
+    }
+    else
+  #endif
+      do_blocking_move_to(npos);
 
   float measured_z = NAN;
   if (!deploy()) measured_z = run_z_probe(sanity_check) + offset.z;
+
+  #if ENABLED(PIPELINED_PROBING)
+    approach_z = NAN;
+    // Raise without waiting, so the travel to the next point runs on
+    const bool queue_raise = pipelined && (raise_after == PROBE_PT_RAISE || TERN0(OPTIMIZE_PROBE_PATH, raise_after == PROBE_PT_NEAR_RAISE));
+    expected_z = queue_raise ? measured_z : NAN;
+    #define PROBE_RAISE_TO(Z) do{ \
+      if (queue_raise) { current_position.z = Z; line_to_current_position(MMM_TO_MMS(Z_PROBE_SPEED_FAST)); } \
+      else do_blocking_move_to_z(Z, MMM_TO_MMS(Z_PROBE_SPEED_FAST)); \
+    }while(0)
+  #else
+    #define PROBE_RAISE_TO(Z) do_blocking_move_to_z(Z, MMM_TO_MMS(Z_PROBE_SPEED_FAST))
+  #endif
+
   if (!isnan(measured_z)) {
     const bool big_raise = raise_after == PROBE_PT_BIG_RAISE;
     if (big_raise || raise_after == PROBE_PT_RAISE)
-      do_blocking_move_to_z(current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), MMM_TO_MMS(Z_PROBE_SPEED_FAST));
+      PROBE_RAISE_TO(current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES));
+    #if ENABLED(OPTIMIZE_PROBE_PATH)
+      else if (raise_after == PROBE_PT_NEAR_RAISE)
+        PROBE_RAISE_TO(current_position.z + (PROBE_PATH_NEAR_CLEARANCE));
+    #endif
     else if (raise_after == PROBE_PT_STOW)
       if (stow()) measured_z = NAN;   // Error on stow?
 
@@ -35,6 +35,9 @@
     PROBE_PT_STOW,      // Do a complete stow after run_z_probe
     PROBE_PT_RAISE,     // Raise to "between" clearance after run_z_probe
     PROBE_PT_BIG_RAISE  // Raise to big clearance after run_z_probe
+    #if ENABLED(OPTIMIZE_PROBE_PATH)
+      , PROBE_PT_NEAR_RAISE // Raise to "near" clearance, for a neighboring grid point
+    #endif
   };
 #endif
 
@@ -45,6 +48,15 @@ public:
 
     static xyz_pos_t offset;
 
+    #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+      static float overshoot;   // (mm) Z past the trigger where the last probe stopped
+    #endif
+
+    #if ENABLED(PIPELINED_PROBING)
+      static bool pipelined;    // Queue the raise, travel and descent between points
+      static float expected_z;  // Bed Z expected at the next point, NAN if unknown
+    #endif
+
     static bool set_deployed(const bool deploy);
 
 
@@ -208,6 +220,9 @@ public:
   #endif
 
 private:
+  #if ENABLED(PIPELINED_PROBING)
+    static float approach_z;    // Where the queued fast descent ends, NAN if none
+  #endif
   static bool probe_down_to_z(const float z, const feedRate_t fr_mm_s);
   static void do_z_raise(const float z_raise);
   static float run_z_probe(const bool sanity_check=true);
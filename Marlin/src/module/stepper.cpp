@@ -107,6 +107,10 @@ Stepper stepper; // Singleton
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(BACKLASH_COMPENSATION)
+  #include "../feature/backlash.h"
+#endif
+
 #if MB(ALLIGATOR)
   #include "../feature/dac/dac_dac084s085.h"
 #endif
@@ -209,7 +213,16 @@ uint32_t Stepper::advance_divisor = 0,
   bool Stepper::bezier_2nd_half;    // =false If Bézier curve has been initialized or not
 #endif
 
-#if ENABLED(LIN_ADVANCE)
+#if ENABLED(LIN_ADVANCE_SMOOTHING)
+
+  int32_t Stepper::LA_advance = 0,
+          Stepper::LA_advance_rem = 0;
+  uint16_t Stepper::LA_alpha_rem = 0;
+  int16_t Stepper::LA_applied = 0,
+          Stepper::LA_steps = 0;
+  int8_t  Stepper::LA_dir = 0;
+
+#elif ENABLED(LIN_ADVANCE)
 
   uint32_t Stepper::nextAdvanceISR = LA_ADV_NEVER,
            Stepper::LA_isr_rate = LA_ADV_NEVER;
@@ -225,6 +238,22 @@ uint32_t Stepper::advance_divisor = 0,
 
 #if ENABLED(INTEGRATED_BABYSTEPPING)
   uint32_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
+  step_ramp_t Stepper::babystep_ramp;
+  uint8_t Stepper::babystep_dirs = 0;
+#endif
+
+#if ENABLED(BACKLASH_COMPENSATION)
+  uint32_t Stepper::nextBacklashISR = BACKLASH_NEVER;
+  step_ramp_t Stepper::backlash_ramp;
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+  uint32_t Stepper::nextShapingISR = SHAPING_NEVER,
+           Stepper::shaping_time = 0;
+  shaping_axis_t Stepper::shaping[2];
+  volatile bool Stepper::shaping_pending = false;
+  float Stepper::shaping_freq[2], Stepper::shaping_zeta[2];
+  uint8_t Stepper::shaping_type[2];
 #endif
 
 int32_t Stepper::ticks_nominal = -1;
@@ -233,6 +262,12 @@ int32_t Stepper::ticks_nominal = -1;
 #endif
 
 xyz_long_t Stepper::endstops_trigsteps;
+
+#if ENABLED(ENDSTOP_TRIGGER_TIMING)
+  xyz_float_t Stepper::endstops_trigoffset;
+  uint8_t Stepper::endstops_trigtimed;
+  uint32_t Stepper::step_clock, Stepper::last_step_clock, Stepper::main_interval;
+#endif
 xyze_long_t Stepper::count_position{0};
 xyze_int8_t Stepper::count_direction{0};
 
@@ -450,12 +485,23 @@ void Stepper::set_directions() {
       count_direction[_AXIS(A)] = 1;            \
     }
 
+  #if ENABLED(INPUT_SHAPING)
+    // Shaped axes set their direction pins as they step
+    #define SET_SHAPED_STEP_DIR(A) do{ \
+      if (shaping[_AXIS(A)].echoes) \
+        count_direction[_AXIS(A)] = motor_direction(_AXIS(A)) ? -1 : 1; \
+      else { SET_STEP_DIR(A); } \
+    }while(0)
+  #else
+    #define SET_SHAPED_STEP_DIR SET_STEP_DIR
+  #endif
+
   #if HAS_X_DIR
-    SET_STEP_DIR(X); // A
+    SET_SHAPED_STEP_DIR(X); // A
   #endif
 
   #if HAS_Y_DIR
-    SET_STEP_DIR(Y); // B
+    SET_SHAPED_STEP_DIR(Y); // B
   #endif
 
   #if HAS_Z_DIR
@@ -484,6 +530,9 @@ void Stepper::set_directions() {
         count_direction.e = 1;
       }
     #endif
+  #elif ENABLED(LIN_ADVANCE_SMOOTHING)
+    // The E direction is set as the E steps are taken
+    count_direction.e = motor_direction(E_AXIS) ? -1 : 1;
   #endif // !LIN_ADVANCE
 
   #if HAS_L64XX
@@ -1345,6 +1394,11 @@ void Stepper::isr() {
     DISABLE_ISRS();
   #endif
 
+  #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+    // The timer period that just ended
+    step_clock += HAL_timer_get_compare(STEP_TIMER_NUM);
+  #endif
+
   // Program timer compare for the maximum period, so it does NOT
   // flag an interrupt while this ISR is running - So changes from small
   // periods to big periods are respected and the timer does not reset to 0
@@ -1364,22 +1418,35 @@ void Stepper::isr() {
 
     if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
 
-    #if ENABLED(LIN_ADVANCE)
+    #if ENABLED(LIN_ADVANCE) && DISABLED(LIN_ADVANCE_SMOOTHING)
       if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
     #endif
 
+    #if ENABLED(INPUT_SHAPING)
+      if (!nextShapingISR) nextShapingISR = shaping_isr();          // 0 = Do delayed X and Y pulses
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       const bool is_babystep = (nextBabystepISR == 0);              // 0 = Do Babystepping (XY)Z pulses
       if (is_babystep) nextBabystepISR = babystepping_isr();
     #endif
 
+    #if ENABLED(BACKLASH_COMPENSATION)
+      if (!nextBacklashISR) nextBacklashISR = backlash_isr();       // 0 = Do Backlash correction (XYZ) pulses
+    #endif
+
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    if (!nextMainISR) {
+      nextMainISR = block_phase_isr();                  // Manage acc/deceleration, get next block
+      #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+        main_interval = nextMainISR;
+      #endif
+    }
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
-        NOLESS(nextMainISR, (BABYSTEP_TICKS) / 8);      // FULL STOP for 125µs after a baby-step
+        NOLESS(nextMainISR, (STEPPER_TIMER_TICKS_PER_US) * 125UL); // FULL STOP for 125µs after a baby-step
 
       if (nextBabystepISR != BABYSTEP_NEVER)            // Avoid baby-stepping too close to axis Stepping
         NOLESS(nextBabystepISR, nextMainISR / 2);       // TODO: Only look at axes enabled for baby-stepping
@@ -1388,12 +1455,18 @@ void Stepper::isr() {
     // Get the interval to the next ISR call
     const uint32_t interval = _MIN(
       nextMainISR                                       // Time until the next Pulse / Block phase
-      #if ENABLED(LIN_ADVANCE)
+      #if ENABLED(LIN_ADVANCE) && DISABLED(LIN_ADVANCE_SMOOTHING)
         , nextAdvanceISR                                // Come back early for Linear Advance?
       #endif
       #if ENABLED(INTEGRATED_BABYSTEPPING)
         , nextBabystepISR                               // Come back early for Babystepping?
       #endif
+      #if ENABLED(BACKLASH_COMPENSATION)
+        , nextBacklashISR                               // Come back early for Backlash correction?
+      #endif
+      #if ENABLED(INPUT_SHAPING)
+        , nextShapingISR                                // Come back early for Input Shaping?
+      #endif
       , uint32_t(HAL_TIMER_TYPE_MAX)                    // Come back in a very long time
     );
 
@@ -1406,7 +1479,7 @@ void Stepper::isr() {
 
     nextMainISR -= interval;
 
-    #if ENABLED(LIN_ADVANCE)
+    #if ENABLED(LIN_ADVANCE) && DISABLED(LIN_ADVANCE_SMOOTHING)
       if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval;
     #endif
 
@@ -1414,6 +1487,15 @@ void Stepper::isr() {
       if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval;
     #endif
 
+    #if ENABLED(BACKLASH_COMPENSATION)
+      if (nextBacklashISR != BACKLASH_NEVER) nextBacklashISR -= interval;
+    #endif
+
+    #if ENABLED(INPUT_SHAPING)
+      if (nextShapingISR != SHAPING_NEVER) nextShapingISR -= interval;
+      shaping_time += interval;
+    #endif
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -1489,6 +1571,246 @@ void Stepper::isr() {
 #define ISR_PULSE_CONTROL (MINIMUM_STEPPER_PULSE || MAXIMUM_STEPPER_RATE)
 #define ISR_MULTI_STEPS (ISR_PULSE_CONTROL && DISABLED(I2S_STEPPER_STREAM))
 
+#if ENABLED(INPUT_SHAPING)
+
+  // Echo bursts no closer than the ISR can take them
+  #define SHAPING_MIN_TICKS ((STEPPER_TIMER_RATE) / (MAX_STEP_ISR_FREQUENCY_1X) * 2)
+
+  static_assert(SHAPING_QUANTUM <= 0xFFFF, "SHAPING_MIN_FREQ is too low for this timer. Increase SHAPING_BUFFER_SIZE.");
+
+  /**
+   * Add the first impulse of a commanded step and tell whether a shaped
+   * axis should step now, setting its direction pin for the step.
+   * The axis steps when the shaped position is half a step away.
+   */
+  FORCE_INLINE bool Stepper::shaping_step(const AxisEnum axis, const bool commanded) {
+    shaping_axis_t &sh = shaping[axis];
+    if (commanded) sh.remainder += count_direction[axis] < 0 ? -int16_t(sh.amplitude[0]) : int16_t(sh.amplitude[0]);
+    int8_t dir;
+    if (sh.remainder >= 128) dir = 1;
+    else if (sh.remainder < -128) dir = -1;
+    else return false;
+    sh.remainder -= dir * 256L;
+    if (dir != sh.dir) shaping_set_dir(axis, dir);
+    return true;
+  }
+
+  void Stepper::shaping_set_dir(const AxisEnum axis, const int8_t dir) {
+    DIR_WAIT_BEFORE();
+    if (axis == X_AXIS)
+      X_APPLY_DIR(dir < 0 ? INVERT_X_DIR : !INVERT_X_DIR, false);
+    else
+      Y_APPLY_DIR(dir < 0 ? INVERT_Y_DIR : !INVERT_Y_DIR, false);
+    DIR_WAIT_AFTER();
+    shaping[axis].dir = dir;
+  }
+
+  // Add commanded steps to the record being filled, opening a new one each quantum
+  void Stepper::shaping_record(const AxisEnum axis, const int16_t steps) {
+    shaping_axis_t &sh = shaping[axis];
+    if (sh.record[sh.head].steps && shaping_time - sh.record[sh.head].time >= SHAPING_QUANTUM)
+      shaping_close(sh);
+    shaping_record_t &rec = sh.record[sh.head];
+    if (!rec.steps) rec.time = shaping_time;
+    rec.steps += steps;
+    rec.ticks = shaping_time - rec.time;
+    if (nextShapingISR == SHAPING_NEVER) nextShapingISR = 0;
+    shaping_pending = true;
+  }
+
+  /**
+   * Close the record being filled, pacing its echoes like the steps
+   * they repeat. If the buffer is full the record stays open.
+   */
+  bool Stepper::shaping_close(shaping_axis_t &sh) {
+    const uint8_t next = sh.head + 1 < SHAPING_BUFFER_SIZE ? sh.head + 1 : 0;
+    if (next == sh.tail[sh.echoes - 1]) return false;
+    shaping_record_t &rec = sh.record[sh.head];
+    uint16_t ticks = rec.ticks / uint16_t(ABS(rec.steps));
+    NOLESS(ticks, 1U);
+    uint8_t burst = 1;
+    while (ticks < SHAPING_MIN_TICKS && burst < 128) { ticks <<= 1; burst <<= 1; }
+    rec.ticks = ticks;
+    rec.burst = burst;
+    sh.head = next;
+    sh.record[next].steps = 0;
+    return true;
+  }
+
+  /**
+   * Drop the echoes of an aborted move. The steps not taken are
+   * taken off the stepper position, as for the rest of the block.
+   */
+  void Stepper::shaping_flush() {
+    LOOP_L_N(i, 2) {
+      shaping_axis_t &sh = shaping[i];
+      if (!sh.echoes) continue;
+      int32_t pending = sh.remainder;
+      LOOP_L_N(s, sh.echoes)
+        for (uint8_t r = sh.tail[s];; r = r + 1 < SHAPING_BUFFER_SIZE ? r + 1 : 0) {
+          pending += int32_t(sh.amplitude[s + 1]) * sh.record[r].steps;
+          if (r == sh.head) break;
+        }
+      count_position[i] -= (pending + 128) >> 8;
+      sh.head = sh.tail[0] = sh.tail[1] = 0;
+      sh.record[0].steps = 0;
+      sh.remainder = 0;
+    }
+    nextShapingISR = SHAPING_NEVER;
+    shaping_pending = false;
+  }
+
+  /**
+   * Input Shaping ISR phase. Add the delayed impulses of the commanded
+   * steps as they come due, and step X and Y toward the shaped position.
+   */
+  uint32_t Stepper::shaping_isr() {
+    uint32_t interval = SHAPING_NEVER;
+    uint8_t steps[2] = { 0 };
+
+    LOOP_L_N(i, 2) {
+      shaping_axis_t &sh = shaping[i];
+      if (!sh.echoes) continue;
+
+      // Close the record being filled once it spans the quantum
+      if (sh.record[sh.head].steps) {
+        const uint32_t age = shaping_time - sh.record[sh.head].time;
+        if (age < SHAPING_QUANTUM)
+          NOMORE(interval, SHAPING_QUANTUM - age);
+        else
+          shaping_close(sh);
+      }
+
+      // Add the echoes that are due
+      LOOP_L_N(s, sh.echoes) {
+        while (sh.tail[s] != sh.head) {
+          const shaping_record_t &rec = sh.record[sh.tail[s]];
+          const uint32_t age = shaping_time - rec.time;
+          if (age < sh.delay[s]) { NOMORE(interval, sh.delay[s] - age); break; }
+          sh.remainder += int32_t(sh.amplitude[s + 1]) * rec.steps;
+          sh.ticks = rec.ticks;
+          sh.burst = rec.burst;
+          if (++sh.tail[s] == SHAPING_BUFFER_SIZE) sh.tail[s] = 0;
+        }
+      }
+
+      // Step toward the shaped position in paced bursts
+      if (sh.remainder >= 128 || sh.remainder < -128) {
+        const int32_t wait = sh.next_step - shaping_time;
+        if (wait > 0)
+          NOMORE(interval, uint32_t(wait));
+        else {
+          const int8_t dir = sh.remainder < 0 ? -1 : 1;
+          if (dir != sh.dir) shaping_set_dir(AxisEnum(i), dir);
+          do {
+            sh.remainder -= dir * 256L;
+            steps[i]++;
+          } while (steps[i] < sh.burst && (dir > 0 ? sh.remainder >= 128 : sh.remainder < -128));
+          sh.next_step = shaping_time + sh.ticks;
+          if (sh.remainder >= 128 || sh.remainder < -128) NOMORE(interval, sh.ticks);
+        }
+      }
+    }
+
+    #if ISR_MULTI_STEPS
+      bool firstStep = true;
+      USING_TIMED_PULSE();
+    #endif
+
+    while (steps[X_AXIS] || steps[Y_AXIS]) {
+      #if ISR_MULTI_STEPS
+        if (firstStep)
+          firstStep = false;
+        else
+          AWAIT_LOW_PULSE();
+      #endif
+
+      if (steps[X_AXIS]) X_APPLY_STEP(!INVERT_X_STEP_PIN, 0);
+      if (steps[Y_AXIS]) Y_APPLY_STEP(!INVERT_Y_STEP_PIN, 0);
+
+      #if ISR_PULSE_CONTROL
+        START_HIGH_PULSE();
+        AWAIT_HIGH_PULSE();
+      #endif
+
+      if (steps[X_AXIS]) { X_APPLY_STEP(INVERT_X_STEP_PIN, 0); steps[X_AXIS]--; }
+      if (steps[Y_AXIS]) { Y_APPLY_STEP(INVERT_Y_STEP_PIN, 0); steps[Y_AXIS]--; }
+
+      #if ISR_PULSE_CONTROL
+        if (steps[X_AXIS] || steps[Y_AXIS]) START_LOW_PULSE();
+      #endif
+    }
+
+    shaping_pending = interval != SHAPING_NEVER;
+    return interval;
+  }
+
+  /**
+   * Set the shaper of an axis from the ringing frequency and damping.
+   * The impulses are those of the ZV, ZVD, MZV and EI shapers, with
+   * the delays rounded to timer ticks and the amplitudes to 1/256.
+   * A frequency of 0 turns shaping off for the axis.
+   */
+  bool Stepper::set_shaping(const AxisEnum axis, const float freq, const float zeta, const uint8_t type) {
+    if (!WITHIN(axis, X_AXIS, Y_AXIS) || !WITHIN(zeta, 0, 0.5f) || freq < 0 || type > SHAPER_EI) return false;
+
+    uint8_t echoes = 0;
+    float a[3] = { 1 }, t[3] = { 0 };
+    if (freq > 0) {
+      const float df = SQRT(1 - sq(zeta)),
+                  td = 1 / (freq * df),
+                  k = expf(-zeta * float(M_PI) / df);
+      echoes = 2;
+      t[1] = 0.5f * td; t[2] = td;
+      switch (type) {
+        case SHAPER_ZV:  echoes = 1; a[1] = k; break;
+        case SHAPER_ZVD: a[1] = 2 * k; a[2] = sq(k); break;
+        case SHAPER_MZV: {
+          const float k2 = expf(-0.75f * zeta * float(M_PI) / df);
+          a[0] = 1 - float(M_SQRT1_2); a[1] = (float(M_SQRT2) - 1) * k2; a[2] = a[0] * sq(k2);
+          t[1] = 0.375f * td; t[2] = 0.75f * td;
+        } break;
+        case SHAPER_EI: {
+          constexpr float vtol = 0.05f;     // Vibration left at the design frequency
+          a[0] = 0.25f * (1 + vtol); a[1] = 0.5f * (1 - vtol) * k; a[2] = a[0] * sq(k);
+        } break;
+      }
+      // The buffer must hold the longest delay, and the shortest must outlast a record
+      if (t[echoes] * (STEPPER_TIMER_RATE) > float(SHAPING_QUANTUM) * ((SHAPING_BUFFER_SIZE) - 2)
+        || t[1] * (STEPPER_TIMER_RATE) < float(SHAPING_QUANTUM)
+      ) return false;
+    }
+
+    // Drain the steppers before changing the shaper
+    planner.synchronize();
+
+    const bool was_enabled = suspend();
+    shaping_axis_t &sh = shaping[axis];
+    const float sum = a[0] + a[1] + a[2];
+    uint8_t rest = 255;
+    for (uint8_t s = echoes; s; s--) {
+      sh.amplitude[s] = LROUND(a[s] * 256 / sum);
+      sh.delay[s - 1] = LROUND(t[s] * (STEPPER_TIMER_RATE));
+      rest -= sh.amplitude[s];
+    }
+    sh.amplitude[0] = rest + 1;             // The amplitudes sum to 256
+    sh.echoes = echoes;
+    sh.head = sh.tail[0] = sh.tail[1] = 0;
+    sh.record[0].steps = 0;
+    sh.remainder = 0;
+    sh.dir = 0;
+    shaping_freq[axis] = freq;
+    shaping_zeta[axis] = zeta;
+    shaping_type[axis] = type;
+    if (was_enabled) {
+      set_directions();
+      wake_up();
+    }
+    return true;
+  }
+
+#endif // INPUT_SHAPING
+
 /**
  * This phase of the ISR should ONLY create the pulses for the steppers.
  * This prevents jitter caused by the interval between the start of the
@@ -1501,6 +1823,12 @@ void Stepper::pulse_phase_isr() {
   // If we must abort the current block, do so!
   if (abort_current_block) {
     abort_current_block = false;
+    #if ENABLED(INPUT_SHAPING)
+      shaping_flush();
+    #endif
+    #if ENABLED(BACKLASH_COMPENSATION)
+      backlash.residual_error.reset(); // Quick stops and endstop hits drop the correction along with the move
+    #endif
     if (current_block) {
       axis_did_move = 0;
       current_block = nullptr;
@@ -1511,6 +1839,10 @@ void Stepper::pulse_phase_isr() {
   // If there is no current block, do nothing
   if (!current_block) return;
 
+  #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+    last_step_clock = step_clock_now();
+  #endif
+
   // Count of pending loops and events for this iteration
   const uint32_t pending_events = step_event_count - step_events_completed;
   uint8_t events_to_do = _MIN(pending_events, steps_per_isr);
@@ -1524,6 +1856,9 @@ void Stepper::pulse_phase_isr() {
     USING_TIMED_PULSE();
   #endif
   xyze_bool_t step_needed{0};
+  #if ENABLED(INPUT_SHAPING)
+    int16_t shaped_steps[2] = { 0 };
+  #endif
 
   do {
     #define _APPLY_STEP(AXIS, INV, ALWAYS) AXIS ##_APPLY_STEP(INV, ALWAYS)
@@ -1553,12 +1888,25 @@ void Stepper::pulse_phase_isr() {
       } \
     }while(0)
 
+    #if ENABLED(INPUT_SHAPING)
+      // Shaped axes count the commanded steps and step toward the shaped position
+      #define SHAPED_PULSE_PREP(AXIS) do{ \
+        PULSE_PREP(AXIS); \
+        if (shaping[_AXIS(AXIS)].echoes) { \
+          if (step_needed[_AXIS(AXIS)]) shaped_steps[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+          step_needed[_AXIS(AXIS)] = shaping_step(_AXIS(AXIS), step_needed[_AXIS(AXIS)]); \
+        } \
+      }while(0)
+    #else
+      #define SHAPED_PULSE_PREP PULSE_PREP
+    #endif
+
     // Determine if pulses are needed
     #if HAS_X_STEP
-      PULSE_PREP(X);
+      SHAPED_PULSE_PREP(X);
     #endif
     #if HAS_Y_STEP
-      PULSE_PREP(Y);
+      SHAPED_PULSE_PREP(Y);
     #endif
     #if HAS_Z_STEP
       PULSE_PREP(Z);
@@ -1576,6 +1924,20 @@ void Stepper::pulse_phase_isr() {
           step_needed.e = true;
         #endif
       }
+      #if ENABLED(LIN_ADVANCE_SMOOTHING)
+        // Take one of the E steps. Reverse only for two, so single
+        // advance corrections cancel with the commanded steps instead.
+        const int8_t dir = LA_steps > 0 ? 1 : -1;
+        if ((step_needed.e = LA_steps && (dir == LA_dir || LA_steps > 1 || LA_steps < -1))) {
+          if (dir != LA_dir) {
+            LA_dir = dir;
+            DIR_WAIT_BEFORE();
+            if (dir > 0) NORM_E_DIR(stepper_extruder); else REV_E_DIR(stepper_extruder);
+            DIR_WAIT_AFTER();
+          }
+          LA_steps -= dir;
+        }
+      #endif
     #elif HAS_E0_STEP
       PULSE_PREP(E);
     #endif
@@ -1604,6 +1966,8 @@ void Stepper::pulse_phase_isr() {
       #elif HAS_E0_STEP
         PULSE_START(E);
       #endif
+    #elif ENABLED(LIN_ADVANCE_SMOOTHING)
+      PULSE_START(E);
     #endif
 
     #if ENABLED(I2S_STEPPER_STREAM)
@@ -1636,6 +2000,8 @@ void Stepper::pulse_phase_isr() {
       #elif HAS_E0_STEP
         PULSE_STOP(E);
       #endif
+    #elif ENABLED(LIN_ADVANCE_SMOOTHING)
+      PULSE_STOP(E);
     #endif
 
     #if ISR_MULTI_STEPS
@@ -1643,8 +2009,18 @@ void Stepper::pulse_phase_isr() {
     #endif
 
   } while (--events_to_do);
+
+  #if ENABLED(INPUT_SHAPING)
+    // Keep the commanded steps to be echoed
+    LOOP_L_N(i, 2) if (shaped_steps[i]) shaping_record(AxisEnum(i), shaped_steps[i]);
+  #endif
 }
 
+#if ENABLED(LIN_ADVANCE_SMOOTHING)
+  // Pace of the E steps taken without a block, 10kHz
+  #define LA_IDLE_TICKS ((STEPPER_TIMER_RATE) / 10000UL)
+#endif
+
 // This is the last half of the stepper interrupt: This one processes and
 // properly schedules blocks from the planner. This is executed after creating
 // the step pulses, so it is not time critical, as pulses are already done.
@@ -1654,6 +2030,10 @@ uint32_t Stepper::block_phase_isr() {
   // If no queued movements, just wait 1ms for the next block
   uint32_t interval = (STEPPER_TIMER_RATE) / 1000UL;
 
+  #if ENABLED(LIN_ADVANCE_SMOOTHING)
+    uint32_t advance_step_rate = 0; // The step rate the advance should follow
+  #endif
+
   // If there is a current block
   if (current_block) {
 
@@ -1689,7 +2069,9 @@ uint32_t Stepper::block_phase_isr() {
         interval = calc_timer_interval(acc_step_rate, &steps_per_isr);
         acceleration_time += interval;
 
-        #if ENABLED(LIN_ADVANCE)
+        #if ENABLED(LIN_ADVANCE_SMOOTHING)
+          advance_step_rate = acc_step_rate;
+        #elif ENABLED(LIN_ADVANCE)
           // Fire ISR if final adv_rate is reached
           if (LA_steps && (!LA_use_advance_lead || LA_isr_rate != current_block->advance_speed))
             initiateLA();
@@ -1732,7 +2114,9 @@ uint32_t Stepper::block_phase_isr() {
         interval = calc_timer_interval(step_rate, &steps_per_isr);
         deceleration_time += interval;
 
-        #if ENABLED(LIN_ADVANCE)
+        #if ENABLED(LIN_ADVANCE_SMOOTHING)
+          advance_step_rate = step_rate;
+        #elif ENABLED(LIN_ADVANCE)
           if (LA_use_advance_lead) {
             // Wake up eISR on first deceleration loop and fire ISR if final adv_rate is reached
             if (step_events_completed <= decelerate_after + steps_per_isr || (LA_steps && LA_isr_rate != current_block->advance_speed)) {
@@ -1746,7 +2130,9 @@ uint32_t Stepper::block_phase_isr() {
       // We must be in cruise phase otherwise
       else {
 
-        #if ENABLED(LIN_ADVANCE)
+        #if ENABLED(LIN_ADVANCE_SMOOTHING)
+          advance_step_rate = current_block->nominal_rate;
+        #elif ENABLED(LIN_ADVANCE)
           // If there are any esteps, fire the next advance_isr "now"
           if (LA_steps && LA_isr_rate != current_block->advance_speed) initiateLA();
         #endif
@@ -1902,7 +2288,15 @@ uint32_t Stepper::block_phase_isr() {
       #endif
 
       // Initialize the trapezoid generator from the current block.
-      #if ENABLED(LIN_ADVANCE)
+      #if ENABLED(LIN_ADVANCE_SMOOTHING)
+        #if E_STEPPERS > 1
+          // The advance of the last extruder stays in its nozzle
+          if (stepper_extruder != last_moved_extruder) {
+            LA_advance = LA_advance_rem = LA_applied = LA_steps = 0;
+            LA_dir = 0;
+          }
+        #endif
+      #elif ENABLED(LIN_ADVANCE)
         #if DISABLED(MIXING_EXTRUDER) && E_STEPPERS > 1
           // If the now active extruder wasn't in use during the last move, its pressure is most likely gone.
           if (stepper_extruder != last_moved_extruder) LA_current_adv_steps = 0;
@@ -1938,6 +2332,11 @@ uint32_t Stepper::block_phase_isr() {
         set_directions();
       }
 
+      #if ENABLED(BACKLASH_COMPENSATION)
+        // Reversed axes take up their slack alongside the block
+        if (backlash.add_correction_steps(current_block)) initiateBacklash();
+      #endif
+
       // At this point, we must ensure the movement about to execute isn't
       // trying to force the head against a limit switch. If using interrupt-
       // driven change detection, and already against a limit then no call to
@@ -1945,6 +2344,9 @@ uint32_t Stepper::block_phase_isr() {
       // done against the endstop. So, check the limits here: If the movement
       // is against the limits, the block will be marked as to be killed, and
       // on the next call to this ISR, will be discarded.
+      #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+        last_step_clock = step_clock_now();
+      #endif
       endstops.update();
 
       #if ENABLED(Z_LATE_ENABLE)
@@ -1971,14 +2373,87 @@ uint32_t Stepper::block_phase_isr() {
 
       // Calculate the initial timer interval
       interval = calc_timer_interval(current_block->initial_rate, &steps_per_isr);
+
+      #if ENABLED(LIN_ADVANCE_SMOOTHING)
+        advance_step_rate = current_block->initial_rate;
+      #endif
     }
   }
 
+  #if ENABLED(LIN_ADVANCE_SMOOTHING)
+    // Without a block to carry them, take the E steps from here as the advance relaxes
+    if (!current_block && LA_steps) {
+      advance_step();
+      interval = LA_IDLE_TICKS;
+    }
+    smooth_advance(advance_step_rate, interval);
+  #endif
+
   // Return the interval to wait
   return interval;
 }
 
-#if ENABLED(LIN_ADVANCE)
+#if ENABLED(LIN_ADVANCE_SMOOTHING)
+
+  /**
+   * Move the smoothed advance toward K times the E step rate. The advance
+   * follows the rate of the move through a first order filter with the
+   * LIN_ADVANCE_SMOOTH_TIME time constant, so its rate of change stays
+   * bounded even where S-curve or trapezoid acceleration changes abruptly.
+   * Whole steps of the change are left to the pulse phase.
+   */
+  void Stepper::smooth_advance(const uint32_t step_rate, const uint32_t interval) {
+    const int32_t target = current_block && current_block->use_advance_lead
+      ? int32_t(STEP_MULTIPLY(step_rate, current_block->advance_rate)) << 4 : 0;
+
+    // Fraction of the way to go in this interval, in 1/65536. The factor per
+    // tick has 15 more bits, which are carried over to the next interval, so
+    // long time constants on fast timers still come out right on average.
+    constexpr uint32_t smooth_ticks = uint32_t(LIN_ADVANCE_SMOOTH_TIME) * ((STEPPER_TIMER_RATE) / 1000UL),
+                       smooth_factor = ((1UL << 31) + smooth_ticks / 2) / smooth_ticks;
+    uint32_t alpha = 65536;
+    if (interval < smooth_ticks) {
+      const uint32_t a = interval * smooth_factor + LA_alpha_rem;
+      LA_alpha_rem = a & 0x7FFF;
+      alpha = _MIN(a >> 15, 65536UL);
+    }
+
+    // Whole 1/16 steps go to the advance and the rest is kept for the next
+    // interval, so small changes add up alike in both directions.
+    const int32_t diff = constrain(target - LA_advance, -32767L, 32767L);
+    LA_advance_rem += diff * int32_t(alpha);
+    LA_advance += LA_advance_rem >> 16;
+    LA_advance_rem &= 0xFFFF;
+
+    const int16_t steps = (LA_advance + 8) >> 4;
+    LA_steps += steps - LA_applied;
+    LA_applied = steps;
+  }
+
+  // Take one E step while the stepper is idle
+  void Stepper::advance_step() {
+    const int8_t dir = LA_steps > 0 ? 1 : -1;
+    if (dir != LA_dir) {
+      LA_dir = dir;
+      DIR_WAIT_BEFORE();
+      if (dir > 0) NORM_E_DIR(stepper_extruder); else REV_E_DIR(stepper_extruder);
+      DIR_WAIT_AFTER();
+    }
+    E_STEP_WRITE(stepper_extruder, !INVERT_E_STEP_PIN);
+    #if ISR_PULSE_CONTROL
+      USING_TIMED_PULSE();
+      START_HIGH_PULSE();
+    #endif
+    LA_steps -= dir;
+    #if ISR_PULSE_CONTROL
+      AWAIT_HIGH_PULSE();
+    #endif
+    E_STEP_WRITE(stepper_extruder, INVERT_E_STEP_PIN);
+  }
+
+#endif // LIN_ADVANCE_SMOOTHING
+
+#if ENABLED(LIN_ADVANCE) && DISABLED(LIN_ADVANCE_SMOOTHING)
 
   // Timer interrupt for E. LA_steps is set in the main routine
   uint32_t Stepper::advance_isr() {
@@ -2073,16 +2548,181 @@ uint32_t Stepper::block_phase_isr() {
 
 #endif // LIN_ADVANCE
 
+#if EITHER(INTEGRATED_BABYSTEPPING, BACKLASH_COMPENSATION)
+
+  /**
+   * Step intervals of a constant acceleration (D. Austin, "Generate stepper-motor
+   * speed profiles in real time") in 1/65536 of the first interval from rest:
+   * c(n) = c(n-1) * (4n - 1) / (4n + 1). The same for any acceleration, so each
+   * ramp only scales it by its start interval, with no divide in the ISR.
+   */
+  static const uint16_t step_ramp_table[128] PROGMEM = {
+    65535, 39322, 30583, 25878, 22834, 20659, 19006, 17696, 16623, 15725, 14958, 14293, 13709, 13192, 12729, 12312,
+    11933, 11587, 11270, 10977, 10706, 10454, 10219,  9999,  9793,  9599,  9416,  9244,  9080,  8925,  8777,  8637,
+     8503,  8375,  8253,  8136,  8024,  7916,  7812,  7713,  7617,  7525,  7436,  7350,  7267,  7186,  7109,  7033,
+     6961,  6890,  6821,  6755,  6690,  6627,  6566,  6507,  6449,  6393,  6338,  6284,  6232,  6181,  6132,  6083,
+     6036,  5990,  5944,  5900,  5857,  5815,  5773,  5733,  5693,  5654,  5616,  5579,  5542,  5506,  5471,  5437,
+     5403,  5370,  5337,  5305,  5273,  5242,  5212,  5182,  5153,  5124,  5096,  5068,  5040,  5013,  4987,  4960,
+     4935,  4909,  4884,  4860,  4835,  4812,  4788,  4765,  4742,  4719,  4697,  4675,  4654,  4632,  4611,  4591,
+     4570,  4550,  4530,  4511,  4491,  4472,  4453,  4434,  4416,  4398,  4380,  4362,  4344,  4327,  4310,  4293
+  };
+
+  template<uint32_t START, uint32_t MIN_INTERVAL>
+  uint32_t step_ramp_t::next(const uint32_t remaining) {
+    if (!steps)                                       // Start from rest
+      steps = 1;
+    else if (remaining < steps) {                     // Slow down to stop on the last step
+      if (steps > 1) steps--;
+    }
+    else if (interval > MIN_INTERVAL)                 // Speed up to the top rate
+      steps++;
+    else
+      return interval;
+
+    // Past the end of the table only when the top rate is in reach (See SanityCheck)
+    if (steps > COUNT(step_ramp_table)) return (interval = MIN_INTERVAL);
+
+    constexpr uint16_t start_hi = START >> 16, start_lo = START & 0xFFFF;
+    const uint16_t ratio = pgm_read_word(&step_ramp_table[steps - 1]);
+    interval = uint32_t(start_hi) * ratio + ((uint32_t(start_lo) * ratio) >> 16);
+    NOLESS(interval, MIN_INTERVAL);
+    return interval;
+  }
+
+#endif
+
 #if ENABLED(INTEGRATED_BABYSTEPPING)
 
-  // Timer interrupt for baby-stepping
+  /**
+   * Timer interrupt for baby-stepping
+   *
+   * Step each axis with babysteps to do, and time the next step on a ramp
+   * limited by BABYSTEP_MAX_RATE and BABYSTEP_ACCEL, so a large offset goes
+   * in smoothly. A reversal first slows to a stop, stepping on the old way
+   * and owing those steps back, then starts again from rest.
+   */
   uint32_t Stepper::babystepping_isr() {
+    constexpr uint32_t start_interval = step_ramp_start(BABYSTEP_ACCEL, BABYSTEP_TICKS);
+
+    uint8_t axis_bits = 0, dir_bits = 0;
+    LOOP_LE_N(i, BS_AXIS_IND(Z_AXIS)) {
+      const int16_t todo = babystep.steps[i];
+      if (todo) SBI(axis_bits, i);
+      if (todo < 0) SBI(dir_bits, i);
+    }
+
+    if ((dir_bits ^ babystep_dirs) & axis_bits) {
+      if (babystep_ramp.steps > 1) {                  // Still moving the old way, so slow down first
+        LOOP_LE_N(i, BS_AXIS_IND(Z_AXIS)) if (TEST(axis_bits, i)) {
+          const bool up = !TEST(babystep_dirs, i);
+          do_babystep(BS_AXIS(i), up);
+          babystep.steps[i] += up ? -1 : 1;
+        }
+        return babystep_ramp.next<start_interval, BABYSTEP_TICKS>(0);
+      }
+      babystep_ramp.steps = 0;
+    }
+    babystep_dirs = (babystep_dirs & ~axis_bits) | dir_bits;
+
     babystep.task();
-    return babystep.has_steps() ? BABYSTEP_TICKS : BABYSTEP_NEVER;
+
+    // Steps left on the busiest axis
+    uint16_t remaining = 0;
+    LOOP_LE_N(i, BS_AXIS_IND(Z_AXIS)) {
+      const int16_t todo = babystep.steps[i];
+      NOLESS(remaining, uint16_t(ABS(todo)));
+    }
+
+    if (!remaining) {
+      babystep_ramp.steps = 0;
+      return BABYSTEP_NEVER;
+    }
+
+    return babystep_ramp.next<start_interval, BABYSTEP_TICKS>(remaining);
   }
 
 #endif
 
+#if ENABLED(BACKLASH_COMPENSATION)
+
+  /**
+   * Timer interrupt for backlash correction. Step the axes whose remaining
+   * correction goes the way their motors are set, and time the next step on
+   * a ramp limited by BACKLASH_CORRECTION_RATE and BACKLASH_CORRECTION_ACCEL.
+   * Corrections against the motor direction wait for a block going their way.
+   * The steps take up slack without moving the tool, so they aren't counted.
+   */
+  uint32_t Stepper::backlash_isr() {
+    uint8_t axis_bits = 0;
+    int32_t remaining = 0;
+    LOOP_XYZ(i) {
+      const int32_t error = backlash.residual_error[i];
+      if (error && (error < 0) == motor_direction(AxisEnum(i))) {
+        SBI(axis_bits, i);
+        NOLESS(remaining, ABS(error));
+        backlash.residual_error[i] -= error < 0 ? -1 : 1;
+      }
+    }
+
+    if (!axis_bits) {
+      backlash_ramp.steps = 0;
+      return BACKLASH_NEVER;
+    }
+
+    #if ISR_PULSE_CONTROL
+      USING_TIMED_PULSE();
+      // Keep clear of a pulse just given by the other phases
+      START_LOW_PULSE();
+      AWAIT_LOW_PULSE();
+    #endif
+
+    #define BACKLASH_STEP(AXIS, INV) do{ \
+      if (TEST(axis_bits, _AXIS(AXIS))) _APPLY_STEP(AXIS, INV, false); \
+    }while(0)
+
+    #if HAS_X_STEP
+      BACKLASH_STEP(X, !INVERT_X_STEP_PIN);
+    #endif
+    #if HAS_Y_STEP
+      BACKLASH_STEP(Y, !INVERT_Y_STEP_PIN);
+    #endif
+    #if HAS_Z_STEP
+      BACKLASH_STEP(Z, !INVERT_Z_STEP_PIN);
+    #endif
+
+    #if ISR_PULSE_CONTROL
+      START_HIGH_PULSE();
+    #endif
+
+    // Steps left on the busiest axis after this one
+    remaining--;
+
+    #if ISR_PULSE_CONTROL
+      AWAIT_HIGH_PULSE();
+    #endif
+
+    #if HAS_X_STEP
+      BACKLASH_STEP(X, INVERT_X_STEP_PIN);
+    #endif
+    #if HAS_Y_STEP
+      BACKLASH_STEP(Y, INVERT_Y_STEP_PIN);
+    #endif
+    #if HAS_Z_STEP
+      BACKLASH_STEP(Z, INVERT_Z_STEP_PIN);
+    #endif
+
+    if (!remaining) {
+      backlash_ramp.steps = 0;
+      return BACKLASH_NEVER;
+    }
+
+    constexpr uint32_t min_interval = (STEPPER_TIMER_RATE) / (BACKLASH_CORRECTION_RATE),
+                       start_interval = step_ramp_start(BACKLASH_CORRECTION_ACCEL, min_interval);
+    return backlash_ramp.next<start_interval, min_interval>(remaining);
+  }
+
+#endif // BACKLASH_COMPENSATION
+
 // Check if the given block is busy or not - Must not be called from ISR contexts
 // The current_block could change in the middle of the read by an Stepper ISR, so
 // we must explicitly prevent that!
@@ -2425,6 +3065,21 @@ void Stepper::endstop_triggered(const AxisEnum axis) {
     #endif
   );
 
+  #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+    // Follow the move from the last step to the edge, which may be a few steps back.
+    // A switch found pressed as the block starts has no edge in the block to time.
+    const bool timed = current_block && main_interval && step_events_completed;
+    float offset = 0;
+    if (timed) {
+      const float axis_ratio = float(current_block->steps[axis]) / step_event_count; // Axis steps per step event
+      offset = float(int32_t(endstops.edge_clock - last_step_clock)) * steps_per_isr * axis_ratio / main_interval;
+      // Never further back than the block's first step, nor ahead of the next pulse phase
+      offset = constrain(offset, -float(step_events_completed) * axis_ratio, steps_per_isr * axis_ratio);
+    }
+    endstops_trigoffset[axis] = offset * count_direction[axis];
+    SET_BIT_TO(endstops_trigtimed, axis, timed);
+  #endif
+
   // Discard the rest of the move if there is a current block
   quick_stop();
 
@@ -196,7 +196,8 @@
 #define ISR_LOOP_CYCLES (ISR_LOOP_BASE_CYCLES + _MAX(MIN_STEPPER_PULSE_CYCLES, MIN_ISR_LOOP_CYCLES))
 
 // If linear advance is enabled, then it is handled separately
-#if ENABLED(LIN_ADVANCE)
+// Smoothed advance steps E in the loop, so it only adds to the base
+#if ENABLED(LIN_ADVANCE) && DISABLED(LIN_ADVANCE_SMOOTHING)
 
   // Estimate the minimum LA loop time
   #if ENABLED(MIXING_EXTRUDER) // ToDo: ???
@@ -233,6 +234,60 @@
 // The minimum allowable frequency for step smoothing will be 1/10 of the maximum nominal frequency (in Hz)
 #define MIN_STEP_ISR_FREQUENCY MAX_STEP_ISR_FREQUENCY_1X
 
+#if ENABLED(INPUT_SHAPING)
+
+  // Ticks covered by one step record, so the buffer spans the longest shaper
+  #define SHAPING_QUANTUM ((STEPPER_TIMER_RATE) / ((SHAPING_MIN_FREQ) * ((SHAPING_BUFFER_SIZE) - 2)))
+
+  enum ShaperType : uint8_t { SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV, SHAPER_EI };
+
+  // The net steps commanded on one axis during one quantum
+  typedef struct {
+    uint32_t time;              // Shaping clock when the record was opened
+    int16_t steps;              // Net commanded steps
+    uint16_t ticks;             // Span of the steps, then the interval between echo bursts
+    uint8_t burst;              // Echo steps per burst, to keep under the ISR rate
+  } shaping_record_t;
+
+  typedef struct {
+    shaping_record_t record[SHAPING_BUFFER_SIZE];
+    uint8_t head,               // Record being filled
+            tail[2],            // Next record to echo, for each delayed impulse
+            echoes,             // Delayed impulses, 0 if the axis is not shaped
+            amplitude[3];       // Impulse amplitudes, in 1/256, summing to 256
+    uint32_t delay[2];          // Delays of the echoes, in timer ticks
+    int32_t remainder;          // Shaped position less stepped position, in 1/256 step
+    uint32_t next_step;         // Shaping clock of the next echo burst
+    uint16_t ticks;             // Pace of the echoes being stepped
+    uint8_t burst;
+    int8_t dir;                 // Direction pin: 1, -1 or 0 if unknown
+  } shaping_axis_t;
+
+#endif
+
+#if EITHER(INTEGRATED_BABYSTEPPING, BACKLASH_COMPENSATION)
+
+  // Square root of a constant, by Newton's method
+  constexpr float _step_ramp_sqrt(const float v, const float x=1, const uint8_t n=40) {
+    return n ? _step_ramp_sqrt(v, 0.5f * (x + v / x), n - 1) : x;
+  }
+
+  // Ticks to the first step from rest at 'accel' steps/s², 0.676 * sqrt(2 / accel) s (D. Austin), no faster than 'min_interval'
+  constexpr uint32_t step_ramp_start(const float accel, const uint32_t min_interval) {
+    return _MAX(min_interval, uint32_t(0.676f * (STEPPER_TIMER_RATE) * _step_ramp_sqrt(2.0f / accel)));
+  }
+
+  // Steps timed on their own ramp, from rest up to a top rate and down to stop on the last step
+  typedef struct {
+    uint32_t interval;          // Ticks to the next step
+    uint16_t steps;             // Steps taken to reach the current rate, 0 at rest
+
+    // Ticks to the next step with 'remaining' steps left after it
+    template<uint32_t START, uint32_t MIN_INTERVAL> uint32_t next(const uint32_t remaining);
+  } step_ramp_t;
+
+#endif
+
 //
 // Stepper class definition
 //
@@ -321,7 +376,14 @@ class Stepper {
       static bool bezier_2nd_half; // If Bézier curve has been initialized or not
     #endif
 
-    #if ENABLED(LIN_ADVANCE)
+    #if ENABLED(LIN_ADVANCE_SMOOTHING)
+      static int32_t LA_advance,   // Smoothed advance, in 1/16 E steps
+                     LA_advance_rem; // Fraction of LA_advance not applied yet, in 1/65536
+      static uint16_t LA_alpha_rem;  // Fraction of the filter factor not applied yet
+      static int16_t LA_applied,   // Advance steps given to the E stepper so far
+                     LA_steps;     // E steps to take, commanded and advance
+      static int8_t LA_dir;        // Direction set on the E stepper, 0 if not known
+    #elif ENABLED(LIN_ADVANCE)
       static constexpr uint32_t LA_ADV_NEVER = 0xFFFFFFFF;
       static uint32_t nextAdvanceISR, LA_isr_rate;
       static uint16_t LA_current_adv_steps, LA_final_adv_steps, LA_max_adv_steps; // Copy from current executed block. Needed because current_block is set to NULL "too early".
@@ -332,6 +394,22 @@ class Stepper {
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       static constexpr uint32_t BABYSTEP_NEVER = 0xFFFFFFFF;
       static uint32_t nextBabystepISR;
+      static step_ramp_t babystep_ramp;
+      static uint8_t babystep_dirs;           // Bits of the axes last babystepped down
+    #endif
+
+    #if ENABLED(BACKLASH_COMPENSATION)
+      static constexpr uint32_t BACKLASH_NEVER = 0xFFFFFFFF;
+      static uint32_t nextBacklashISR;
+      static step_ramp_t backlash_ramp;
+    #endif
+
+    #if ENABLED(INPUT_SHAPING)
+      static constexpr uint32_t SHAPING_NEVER = 0xFFFFFFFF;
+      static uint32_t nextShapingISR,
+                      shaping_time;           // Ticks since power-up, wrapping
+      static shaping_axis_t shaping[2];       // X and Y
+      static volatile bool shaping_pending;   // Echoes not yet stepped
     #endif
 
     static int32_t ticks_nominal;
@@ -344,6 +422,14 @@ class Stepper {
     //
     static xyz_long_t endstops_trigsteps;
 
+    #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+      static xyz_float_t endstops_trigoffset; // Steps from there to the triggering edge
+      static uint8_t endstops_trigtimed;      // Axes whose trigger was timed from an edge during the move
+      static uint32_t step_clock,             // Ticks since power-up at the start of the timer period, wrapping
+                      last_step_clock,        // Time of the last pulse phase
+                      main_interval;          // Ticks from the last pulse phase to the next
+    #endif
+
     //
     // Positions of stepper motors, in step units
     //
@@ -382,7 +468,11 @@ class Stepper {
     // The stepper block processing ISR phase
     static uint32_t block_phase_isr();
 
-    #if ENABLED(LIN_ADVANCE)
+    #if ENABLED(LIN_ADVANCE_SMOOTHING)
+      // Move the advance toward the one for a step rate
+      static void smooth_advance(const uint32_t step_rate, const uint32_t interval);
+      static void advance_step();
+    #elif ENABLED(LIN_ADVANCE)
       // The Linear advance ISR phase
       static uint32_t advance_isr();
       FORCE_INLINE static void initiateLA() { nextAdvanceISR = 0; }
@@ -399,6 +489,28 @@ class Stepper {
       }
     #endif
 
+    #if ENABLED(BACKLASH_COMPENSATION)
+      // The Backlash correction ISR phase
+      static uint32_t backlash_isr();
+      FORCE_INLINE static void initiateBacklash() {
+        if (nextBacklashISR == BACKLASH_NEVER) nextBacklashISR = 0;
+      }
+    #endif
+
+    #if ENABLED(INPUT_SHAPING)
+      // The Input Shaping ISR phase
+      static uint32_t shaping_isr();
+
+      static float shaping_freq[2], shaping_zeta[2];
+      static uint8_t shaping_type[2];
+
+      // Set the shaper of an axis, waiting for the steppers to finish. False if out of range.
+      static bool set_shaping(const AxisEnum axis, const float freq, const float zeta, const uint8_t type);
+
+      // Steps still to be taken after the planner is empty
+      FORCE_INLINE static bool shaping_busy() { return shaping_pending; }
+    #endif
+
     // Check if the given block is busy or not - Must not be called from ISR contexts
     static bool is_block_busy(const block_t* const block);
 
@@ -438,6 +550,17 @@ class Stepper {
     // Triggered position of an axis in steps
     static int32_t triggered_position(const AxisEnum axis);
 
+    #if ENABLED(ENDSTOP_TRIGGER_TIMING)
+      // Steps from the triggered position to the edge that triggered it
+      FORCE_INLINE static float triggered_offset(const AxisEnum axis) { return endstops_trigoffset[axis]; }
+
+      // False if the switch was found pressed as the move began, so there was no edge to time
+      FORCE_INLINE static bool triggered_on_edge(const AxisEnum axis) { return TEST(endstops_trigtimed, axis); }
+
+      // The time now on the step timeline
+      FORCE_INLINE static uint32_t step_clock_now() { return step_clock + HAL_timer_get_count(STEP_TIMER_NUM); }
+    #endif
+
     #if HAS_DIGIPOTSS || HAS_MOTOR_CURRENT_PWM
       static void digitalPotWrite(const int16_t address, const int16_t value);
       static void digipot_current(const uint8_t driver, const int16_t current);
@@ -484,6 +607,14 @@ class Stepper {
 
   private:
 
+    #if ENABLED(INPUT_SHAPING)
+      static bool shaping_step(const AxisEnum axis, const bool commanded);
+      static void shaping_set_dir(const AxisEnum axis, const int8_t dir);
+      static void shaping_record(const AxisEnum axis, const int16_t steps);
+      static bool shaping_close(shaping_axis_t &sh);
+      static void shaping_flush();
+    #endif
+
     // Set the current position in steps
     static void _set_position(const int32_t &a, const int32_t &b, const int32_t &c, const int32_t &e);
     FORCE_INLINE static void _set_position(const abce_long_t &spos) { _set_position(spos.a, spos.b, spos.c, spos.e); }
@@ -2799,6 +2799,8 @@ void Temperature::tick() {
   /**
    * One sensor is sampled on every other call of the ISR.
    * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
+   * With HAL_ADC_FILTERED the HAL delivers an already filtered value,
+   * so every pass produces a new reading (OVERSAMPLENR is 1).
    *
    * On each Prepare pass, ADC is started for a sensor pin.
    * On the next pass, the ADC value is read and accumulated.
@@ -42,6 +42,14 @@
   #include "../feature/powerloss.h"
 #endif
 
+#if ENABLED(SD_LAYER_INDEX)
+  #include "../feature/layer_index.h"
+#endif
+
+#if ENABLED(SD_FILE_ANALYSIS)
+  #include "../feature/file_analysis.h"
+#endif
+
 #if ENABLED(ADVANCED_PAUSE_FEATURE)
   #include "../feature/pause.h"
 #endif
@@ -411,6 +419,9 @@ void CardReader::endFilePrint(
   #endif
   flag.sdprinting = flag.abort_sd_printing = false;
   if (isFileOpen()) file.close();
+  #if ENABLED(SD_LAYER_INDEX)
+    layer_index.finish();
+  #endif
   #if SD_RESORT
     if (re_sort) presort();
   #endif
@@ -520,6 +531,10 @@ void CardReader::openFileRead(char * const path, const uint8_t subcall_type/*=0*
 
     selectFileByName(fname);
     ui.set_status(longFilename[0] ? longFilename : fname);
+
+    #if ENABLED(SD_FILE_ANALYSIS)
+      if (!subcall_type) file_analysis.begin(curDir, fname);
+    #endif
   }
   else
     openFailed(fname);
@@ -1111,6 +1126,9 @@ void CardReader::fileHasFinished() {
 
 #if ENABLED(POWER_LOSS_RECOVERY)
 
+  uint32_t CardReader::jobRecoveryBlock; // = 0
+  uint32_t CardReader::jobRecoveryData[512 / sizeof(uint32_t)];
+
   bool CardReader::jobRecoverFileExists() {
     const bool exists = recovery.file.open(&root, recovery.filename, O_READ);
     if (exists) recovery.file.close();
@@ -1130,6 +1148,7 @@ void CardReader::fileHasFinished() {
   // the file being printed, so during SD printing the file should
   // be zeroed and written instead of deleted.
   void CardReader::removeJobRecoveryFile() {
+    jobRecoveryBlock = 0; // Its blocks are about to be freed
     if (jobRecoverFileExists()) {
       recovery.init();
       removeFile(recovery.filename);
@@ -1140,6 +1159,51 @@ void CardReader::fileHasFinished() {
     }
   }
 
+  /**
+   * Make sure the recovery file is one contiguous run of blocks, so records
+   * can be written to the card without touching the FAT or the directory.
+   * A new file is cleared, as its blocks may hold old records.
+   */
+  bool CardReader::prepareJobRecoveryFile() {
+    jobRecoveryBlock = 0;
+    if (!isMounted() || recovery.file.isOpen()) return false;
+
+    constexpr uint32_t size = POWER_LOSS_SLOTS * 512UL;
+    uint32_t bgn, end;
+    if (recovery.file.open(&root, recovery.filename, O_RDWR)) {
+      if (recovery.file.fileSize() >= size && recovery.file.contiguousRange(&bgn, &end)) {
+        recovery.file.close();
+        jobRecoveryBlock = bgn;
+        return true;
+      }
+      recovery.file.remove(); // Not usable in place. (Not removeFile, which would close the print.)
+    }
+
+    if (!recovery.file.createContiguous(&root, recovery.filename, size) || !recovery.file.contiguousRange(&bgn, &end)) {
+      recovery.file.close();
+      SERIAL_ECHOLNPAIR(STR_SD_OPEN_FILE_FAIL, recovery.filename, ".");
+      return false;
+    }
+    recovery.file.close();
+
+    uint8_t * const buffer = jobRecoveryBuffer();
+    memset(buffer, 0, 512);
+    LOOP_L_N(slot, POWER_LOSS_SLOTS)
+      if (!sd2card.writeBlock(bgn + slot, buffer)) return false;
+
+    jobRecoveryBlock = bgn;
+    return true;
+  }
+
 #endif // POWER_LOSS_RECOVERY
 
+#if ENABLED(SD_LAYER_INDEX)
+
+  bool CardReader::openLayerIndexFile(const bool write) {
+    if (!isMounted() || layer_index.file.isOpen()) return false;
+    return layer_index.file.open(&root, layer_index.filename, write ? O_CREAT | O_WRITE | O_TRUNC : O_READ);
+  }
+
+#endif // SD_LAYER_INDEX
+
 #endif // SDSUPPORT
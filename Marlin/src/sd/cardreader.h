@@ -143,10 +143,26 @@ public:
     static bool jobRecoverFileExists();
     static void openJobRecoveryFile(const bool read);
     static void removeJobRecoveryFile();
+    static bool prepareJobRecoveryFile();
+
+    // Blocks of the recovery file are written in place, bypassing the FAT and the directory
+    static uint32_t jobRecoveryBlock;  // First block of the contiguous file, or 0
+    // The records are built in a block of their own, so the volume cache keeps the print file
+    static uint32_t jobRecoveryData[512 / sizeof(uint32_t)];
+    static inline uint8_t* jobRecoveryBuffer() { return (uint8_t*)jobRecoveryData; }
+    static inline bool writeJobRecoveryBlock(const uint8_t slot, const uint8_t * const buffer) {
+      return jobRecoveryBlock && sd2card.writeBlock(jobRecoveryBlock + slot, buffer);
+    }
+  #endif
+
+  #if ENABLED(SD_LAYER_INDEX)
+    static bool openLayerIndexFile(const bool write);
+    static inline bool inSubcall() { return file_subcall_ctr > 0; }
   #endif
 
   static inline bool isFileOpen() { return isMounted() && file.isOpen(); }
   static inline uint32_t getIndex() { return sdpos; }
+  static inline uint32_t getFileSize() { return filesize; }
   static inline bool eof() { return sdpos >= filesize; }
   static inline void setIndex(const uint32_t index) { sdpos = index; file.seekSet(index); }
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }